@@ -2312,6 +2312,23 @@ bool _Engine::is_editor_hint() const {
 	return Engine::get_singleton()->is_editor_hint();
 }
 
+void _Engine::start_trace_recording(int p_events_per_thread) {
+	ERR_FAIL_COND_MSG(p_events_per_thread <= 0, "The number of events per thread must be greater than 0.");
+	TraceRecorder::start(p_events_per_thread);
+}
+
+void _Engine::stop_trace_recording() {
+	TraceRecorder::stop();
+}
+
+bool _Engine::is_trace_recording() const {
+	return TraceRecorder::is_recording();
+}
+
+Error _Engine::save_trace(const String &p_path) {
+	return TraceRecorder::save(p_path);
+}
+
 void _Engine::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_iterations_per_second", "iterations_per_second"), &_Engine::set_iterations_per_second);
 	ClassDB::bind_method(D_METHOD("get_iterations_per_second"), &_Engine::get_iterations_per_second);
@@ -2346,6 +2363,11 @@ void _Engine::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_editor_hint", "enabled"), &_Engine::set_editor_hint);
 	ClassDB::bind_method(D_METHOD("is_editor_hint"), &_Engine::is_editor_hint);
 
+	ClassDB::bind_method(D_METHOD("start_trace_recording", "events_per_thread"), &_Engine::start_trace_recording, DEFVAL(TraceRecorder::DEFAULT_EVENTS_PER_THREAD));
+	ClassDB::bind_method(D_METHOD("stop_trace_recording"), &_Engine::stop_trace_recording);
+	ClassDB::bind_method(D_METHOD("is_trace_recording"), &_Engine::is_trace_recording);
+	ClassDB::bind_method(D_METHOD("save_trace", "path"), &_Engine::save_trace);
+
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "editor_hint"), "set_editor_hint", "is_editor_hint");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "iterations_per_second"), "set_iterations_per_second", "get_iterations_per_second");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "target_fps"), "set_target_fps", "get_target_fps");
@@ -31,6 +31,7 @@
 #ifndef CORE_BIND_H
 #define CORE_BIND_H
 
+#include "core/debugger/trace_recorder.h"
 #include "core/image.h"
 #include "core/io/compression.h"
 #include "core/io/resource_loader.h"
@@ -642,6 +643,11 @@ public:
 	void set_editor_hint(bool p_enabled);
 	bool is_editor_hint() const;
 
+	void start_trace_recording(int p_events_per_thread = TraceRecorder::DEFAULT_EVENTS_PER_THREAD);
+	void stop_trace_recording();
+	bool is_trace_recording() const;
+	Error save_trace(const String &p_path);
+
 	_Engine() { singleton = this; }
 };
 
@@ -242,7 +242,20 @@ HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
+std::atomic<bool> ClassDB::frozen(false);
+HashMap<StringName, ClassDB::ClassInfo *> ClassDB::frozen_classes;
+
 bool ClassDB::is_parent_class(const StringName &p_class, const StringName &p_inherits) {
+	ClassInfo *frozen_type = _get_frozen_class(p_class);
+	if (frozen_type) {
+		for (ClassInfo *check = frozen_type; check; check = check->inherits_ptr) {
+			if (check->name == p_inherits) {
+				return true;
+			}
+		}
+		return false;
+	}
+
 	OBJTYPE_RLOCK;
 
 	StringName inherits = p_class;
@@ -619,6 +632,12 @@ void ClassDB::get_method_list(StringName p_class, List<MethodInfo> *p_methods, b
 }
 
 MethodBind *ClassDB::get_method(StringName p_class, StringName p_name) {
+	ClassInfo *frozen_type = _get_frozen_class(p_class);
+	if (frozen_type) {
+		MethodBind **method = frozen_type->flat_method_map.getptr(p_name);
+		return method ? *method : nullptr;
+	}
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -644,6 +663,8 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 		ERR_FAIL();
 	}
 
+	_invalidate_frozen(type);
+
 	type->constant_map[p_name] = p_constant;
 
 	String enum_name = p_enum;
@@ -800,6 +821,7 @@ void ClassDB::add_signal(StringName p_class, const MethodInfo &p_signal) {
 	}
 #endif
 
+	_invalidate_frozen(type);
 	type->signal_map[sname] = p_signal;
 }
 
@@ -909,6 +931,7 @@ void ClassDB::add_property(StringName p_class, const PropertyInfo &p_pinfo, cons
 
 	OBJTYPE_WLOCK
 
+	_invalidate_frozen(type);
 	type->property_list.push_back(p_pinfo);
 #ifdef DEBUG_METHODS_ENABLED
 	if (mb_get) {
@@ -960,76 +983,98 @@ void ClassDB::get_property_list(StringName p_class, List<PropertyInfo> *p_list,
 }
 
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
+	const PropertySetGet *psg = nullptr;
 
-			Callable::CallError ce;
+	ClassInfo *frozen_type = _get_frozen_class(p_object->get_class_name());
+	if (frozen_type) {
+		const PropertyLookup *lookup = frozen_type->flat_property_map.getptr(p_property);
+		if (lookup) {
+			psg = lookup->setget;
+		}
+	} else {
+		ClassInfo *check = classes.getptr(p_object->get_class_name());
+		while (check && !psg) {
+			psg = check->property_setget.getptr(p_property);
+			check = check->inherits_ptr;
+		}
+	}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->call(psg->setter, arg, 2, ce);
-				}
+	if (!psg) {
+		return false;
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->call(psg->setter, arg, 1, ce);
-				}
-			}
+	if (!psg->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return true; //return true but do nothing
+	}
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	Callable::CallError ce;
 
-			return true;
+	if (psg->index >= 0) {
+		Variant index = psg->index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(psg->setter,arg,2,ce);
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->call(psg->setter, arg, 2, ce);
 		}
 
-		check = check->inherits_ptr;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->call(psg->setter, arg, 1, ce);
+		}
 	}
 
-	return false;
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+
+	return true;
+}
+
+static void _call_property_getter(Object *p_object, const ClassDB::PropertySetGet *psg, Variant &r_value) {
+	if (!psg->getter) {
+		return; //do nothing
+	}
+
+	if (psg->index >= 0) {
+		Variant index = psg->index;
+		const Variant *arg[1] = { &index };
+		Callable::CallError ce;
+		r_value = p_object->call(psg->getter, arg, 1, ce);
+
+	} else {
+		Callable::CallError ce;
+		if (psg->_getptr) {
+			r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
+		} else {
+			r_value = p_object->call(psg->getter, nullptr, 0, ce);
+		}
+	}
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
+	ClassInfo *frozen_type = _get_frozen_class(p_object->get_class_name());
+	if (frozen_type) {
+		const PropertyLookup *lookup = frozen_type->flat_property_map.getptr(p_property);
+		if (lookup && !lookup->get_shadowed) {
+			_call_property_getter(p_object, lookup->setget, r_value);
+			return true;
+		}
+	}
+
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
-
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				r_value = p_object->call(psg->getter, arg, 1, ce);
-
-			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					r_value = p_object->call(psg->getter, nullptr, 0, ce);
-				}
-			}
+			_call_property_getter(p_object, psg, r_value);
 			return true;
 		}
 
@@ -1156,6 +1201,13 @@ void ClassDB::set_method_flags(StringName p_class, StringName p_method, int p_fl
 }
 
 bool ClassDB::has_method(StringName p_class, StringName p_method, bool p_no_inheritance) {
+	if (!p_no_inheritance) {
+		ClassInfo *frozen_type = _get_frozen_class(p_class);
+		if (frozen_type) {
+			return frozen_type->flat_method_map.has(p_method);
+		}
+	}
+
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1214,6 +1266,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 	type->method_order.push_back(mdname);
 #endif
 
+	_invalidate_frozen(type);
 	type->method_map[mdname] = p_bind;
 
 	Vector<Variant> defvals;
@@ -1395,6 +1448,69 @@ void ClassDB::init() {
 	lock = RWLock::create();
 }
 
+void ClassDB::freeze() {
+	OBJTYPE_WLOCK;
+
+	if (frozen_classes.size()) {
+		return; // Already built, tables are never rebuilt while they may be read.
+	}
+
+	const StringName *k = nullptr;
+
+	while ((k = classes.next(k))) {
+		ClassInfo &ti = classes[*k];
+
+		// Names that get_property() resolves to a constant, method or signal before
+		// reaching a property defined further up the hierarchy.
+		Set<StringName> shadowing;
+
+		for (ClassInfo *check = &ti; check; check = check->inherits_ptr) {
+			const StringName *m = nullptr;
+			while ((m = check->property_setget.next(m))) {
+				if (!ti.flat_property_map.has(*m)) {
+					PropertyLookup lookup;
+					lookup.setget = check->property_setget.getptr(*m);
+					lookup.get_shadowed = shadowing.has(*m);
+					ti.flat_property_map[*m] = lookup;
+				}
+			}
+
+			m = nullptr;
+			while ((m = check->constant_map.next(m))) {
+				shadowing.insert(*m);
+			}
+
+			m = nullptr;
+			while ((m = check->method_map.next(m))) {
+				MethodBind *method = check->method_map[*m];
+				if (method && !ti.flat_method_map.has(*m)) {
+					ti.flat_method_map[*m] = method;
+				}
+				shadowing.insert(*m);
+			}
+
+			m = nullptr;
+			while ((m = check->signal_map.next(m))) {
+				shadowing.insert(*m);
+			}
+		}
+
+		ti.flattened = true;
+		frozen_classes[*k] = &ti;
+	}
+
+	frozen.store(true, std::memory_order_release);
+}
+
+void ClassDB::_invalidate_frozen(ClassInfo *p_type) {
+	// Flattened tables are immutable, so modifying a class that was already
+	// flattened sends every lookup back to the locked path.
+	if (p_type->flattened && frozen.load(std::memory_order_relaxed)) {
+		print_verbose("ClassDB: Class '" + String(p_type->name) + "' modified after freeze, lookups will use the locked path.");
+		frozen.store(false, std::memory_order_release);
+	}
+}
+
 void ClassDB::cleanup_defaults() {
 	default_values.clear();
 	default_values_cached.clear();
@@ -1413,6 +1529,8 @@ void ClassDB::cleanup() {
 			memdelete(ti.method_map[*m]);
 		}
 	}
+	frozen.store(false);
+	frozen_classes.clear();
 	classes.clear();
 	resource_base_extensions.clear();
 	compat_classes.clear();
@@ -110,6 +110,11 @@ public:
 		Variant::Type type;
 	};
 
+	struct PropertyLookup {
+		const PropertySetGet *setget = nullptr;
+		bool get_shadowed = false; // A more derived class has a constant, method or signal with the same name.
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -129,6 +134,12 @@ public:
 #endif
 		HashMap<StringName, PropertySetGet> property_setget;
 
+		// Merged lookup tables, including inherited entries. Built once by ClassDB::freeze(),
+		// read only afterwards.
+		HashMap<StringName, MethodBind *> flat_method_map;
+		HashMap<StringName, PropertyLookup> flat_property_map;
+		bool flattened = false;
+
 		StringName inherits;
 		StringName name;
 		bool disabled = false;
@@ -149,6 +160,19 @@ public:
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
+	static std::atomic<bool> frozen;
+	static HashMap<StringName, ClassInfo *> frozen_classes;
+
+	// Returns the class only if its flattened tables can be read without locking.
+	_FORCE_INLINE_ static ClassInfo *_get_frozen_class(const StringName &p_class) {
+		if (!frozen.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+		ClassInfo **ti = frozen_classes.getptr(p_class);
+		return ti ? *ti : nullptr;
+	}
+	static void _invalidate_frozen(ClassInfo *p_type);
+
 #ifdef DEBUG_METHODS_ENABLED
 	static MethodBind *bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const MethodDefinition &method_name, const Variant **p_defs, int p_defcount);
 #else
@@ -377,6 +401,7 @@ public:
 
 	static void add_compatibility_class(const StringName &p_class, const StringName &p_fallback);
 	static void init();
+	static void freeze();
 
 	static void set_current_api(APIType p_api);
 	static APIType get_current_api();
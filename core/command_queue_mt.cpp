@@ -46,27 +46,16 @@ void CommandQueueMT::wait_for_flush() {
 }
 
 CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
-	int idx = -1;
-
 	while (true) {
-		lock();
 		for (int i = 0; i < SYNC_SEMAPHORES; i++) {
-			if (!sync_sems[i].in_use) {
-				sync_sems[i].in_use = true;
-				idx = i;
-				break;
+			bool expected = false;
+			if (sync_sems[i].in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+				return &sync_sems[i];
 			}
 		}
-		unlock();
 
-		if (idx == -1) {
-			wait_for_flush();
-		} else {
-			break;
-		}
+		wait_for_flush();
 	}
-
-	return &sync_sems[idx];
 }
 
 bool CommandQueueMT::dealloc_one() {
@@ -76,7 +65,7 @@ tryagain:
 		return false;
 	}
 
-	uint32_t size = *(uint32_t *)&command_mem[dealloc_ptr];
+	uint32_t size = _header(dealloc_ptr)->load(std::memory_order_acquire);
 
 	if (size == 0) {
 		// End of command buffer wrap down
@@ -93,6 +82,32 @@ tryagain:
 	return true;
 }
 
+void CommandQueueMT::begin_batch() {
+	Thread::ID caller = Thread::get_caller_id();
+
+	lock();
+	if (batch_depth == 0) {
+		batch_thread = caller;
+	}
+	if (batch_thread == caller) {
+		batch_depth++;
+	}
+	unlock();
+}
+
+void CommandQueueMT::end_batch() {
+	Thread::ID caller = Thread::get_caller_id();
+
+	lock();
+	if (batch_depth > 0 && batch_thread == caller) {
+		batch_depth--;
+		if (batch_depth == 0) {
+			publish();
+		}
+	}
+	unlock();
+}
+
 CommandQueueMT::CommandQueueMT(bool p_sync) {
 	if (p_sync) {
 		sync = memnew(Semaphore);
@@ -34,9 +34,12 @@
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
 #include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/simple_type.h"
 #include "core/typedefs.h"
 
+#include <atomic>
+
 #define COMMA(N) _COMMA_##N
 #define _COMMA_0
 #define _COMMA_1 ,
@@ -252,9 +255,7 @@
 		cmd->instance = p_instance;                                          \
 		cmd->method = p_method;                                              \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                 \
-		unlock();                                                            \
-		if (sync)                                                            \
-			sync->post();                                                    \
+		commit_and_unlock();                                                 \
 	}
 
 #define CMD_RET_TYPE(N) CommandRet##N<T, M, COMMA_SEP_LIST(TYPE_ARG, N) COMMA(N) R>
@@ -269,11 +270,10 @@
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                   \
 		cmd->ret = r_ret;                                                                      \
 		cmd->sync_sem = ss;                                                                    \
+		publish();                                                                             \
 		unlock();                                                                              \
-		if (sync)                                                                              \
-			sync->post();                                                                      \
 		ss->sem.wait();                                                                        \
-		ss->in_use = false;                                                                    \
+		ss->in_use.store(false, std::memory_order_release);                                    \
 	}
 
 #define CMD_SYNC_TYPE(N) CommandSync##N<T, M COMMA(N) COMMA_SEP_LIST(TYPE_ARG, N)>
@@ -287,11 +287,10 @@
 		cmd->method = p_method;                                                       \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                          \
 		cmd->sync_sem = ss;                                                           \
+		publish();                                                                    \
 		unlock();                                                                     \
-		if (sync)                                                                     \
-			sync->post();                                                             \
 		ss->sem.wait();                                                               \
-		ss->in_use = false;                                                           \
+		ss->in_use.store(false, std::memory_order_release);                           \
 	}
 
 #define MAX_CMD_PARAMS 15
@@ -299,7 +298,7 @@
 class CommandQueueMT {
 	struct SyncSemaphore {
 		Semaphore sem;
-		bool in_use = false;
+		std::atomic<bool> in_use = { false };
 	};
 
 	struct CommandBase {
@@ -335,14 +334,26 @@ class CommandQueueMT {
 		SYNC_SEMAPHORES = 8
 	};
 
+	// The ring buffer has a single consumer (the server thread, or the main
+	// thread when the server is not threaded), which never takes the mutex.
+	// Producers serialize among themselves through the mutex and hand
+	// commands over by publishing write_ptr; the consumer hands memory back
+	// by clearing the 'in use' bit of each command header.
 	uint8_t *command_mem = (uint8_t *)memalloc(COMMAND_MEM_SIZE);
-	uint32_t read_ptr = 0;
-	uint32_t write_ptr = 0;
-	uint32_t dealloc_ptr = 0;
+	uint32_t read_ptr = 0; // Consumer only.
+	uint32_t write_ptr = 0; // Producers only, under the mutex.
+	uint32_t dealloc_ptr = 0; // Producers only, under the mutex.
+	std::atomic<uint32_t> published_ptr = { 0 };
+	uint32_t batch_depth = 0;
+	Thread::ID batch_thread = 0;
 	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
 	Mutex mutex;
 	Semaphore *sync = nullptr;
 
+	_FORCE_INLINE_ std::atomic<uint32_t> *_header(uint32_t p_pos) {
+		return reinterpret_cast<std::atomic<uint32_t> *>(&command_mem[p_pos]);
+	}
+
 	template <class T>
 	T *allocate() {
 		// alloc size is size+T+safeguard
@@ -378,8 +389,7 @@ class CommandQueueMT {
 				ERR_FAIL_COND_V((COMMAND_MEM_SIZE - write_ptr) < 8, nullptr);
 				// zero means, wrap to beginning
 
-				uint32_t *p = (uint32_t *)&command_mem[write_ptr];
-				*p = 0;
+				_header(write_ptr)->store(0, std::memory_order_relaxed);
 				write_ptr = 0;
 				goto tryagain;
 			}
@@ -388,8 +398,7 @@ class CommandQueueMT {
 		// First bit used to mark if command is still in use (1)
 		// or if it has been destroyed and can be deallocated (0).
 		uint32_t size = (sizeof(T) + 8 - 1) & ~(8 - 1);
-		uint32_t *p = (uint32_t *)&command_mem[write_ptr];
-		*p = (size << 1) | 1;
+		_header(write_ptr)->store((size << 1) | 1, std::memory_order_relaxed);
 		write_ptr += 8;
 		// allocate the command
 		T *cmd = memnew_placement(&command_mem[write_ptr], T);
@@ -403,6 +412,9 @@ class CommandQueueMT {
 		T *ret;
 
 		while ((ret = allocate<T>()) == nullptr) {
+			// Whatever is pending (e.g. in a batch) has to be visible
+			// to the consumer, or no room will ever be made.
+			publish();
 			unlock();
 			// sleep a little until fetch happened and some room is made
 			wait_for_flush();
@@ -412,22 +424,37 @@ class CommandQueueMT {
 		return ret;
 	}
 
-	bool flush_one(bool p_lock = true) {
-		if (p_lock) {
-			lock();
+	// Makes all commands written so far visible to the consumer. Must be
+	// called with the mutex held.
+	_FORCE_INLINE_ void publish() {
+		if (published_ptr.load(std::memory_order_relaxed) == write_ptr) {
+			return;
+		}
+		published_ptr.store(write_ptr, std::memory_order_release);
+		if (sync) {
+			sync->post();
 		}
+	}
+
+	_FORCE_INLINE_ void commit_and_unlock() {
+		// Commands pushed by the thread running a batch are published
+		// all at once when it ends.
+		if (batch_depth == 0 || Thread::get_caller_id() != batch_thread) {
+			publish();
+		}
+		unlock();
+	}
+
+	bool flush_one() {
 	tryagain:
 
 		// tried to read an empty queue
-		if (read_ptr == write_ptr) {
-			if (p_lock) {
-				unlock();
-			}
+		if (read_ptr == published_ptr.load(std::memory_order_acquire)) {
 			return false;
 		}
 
 		uint32_t size_ptr = read_ptr;
-		uint32_t size = *(uint32_t *)&command_mem[read_ptr] >> 1;
+		uint32_t size = _header(read_ptr)->load(std::memory_order_relaxed) >> 1;
 
 		if (size == 0) {
 			//end of ringbuffer, wrap
@@ -441,21 +468,11 @@ class CommandQueueMT {
 
 		read_ptr += size;
 
-		if (p_lock) {
-			unlock();
-		}
 		cmd->call();
-		if (p_lock) {
-			lock();
-		}
-
 		cmd->post();
 		cmd->~CommandBase();
-		*(uint32_t *)&command_mem[size_ptr] &= ~1;
+		_header(size_ptr)->fetch_and(~1u, std::memory_order_release);
 
-		if (p_lock) {
-			unlock();
-		}
 		return true;
 	}
 
@@ -478,18 +495,22 @@ public:
 	DECL_PUSH_AND_SYNC(0)
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
-	void wait_and_flush_one() {
+	// Commands pushed by the calling thread between these two calls are
+	// handed to the consumer at once, waking it up a single time. Batches
+	// nest, and only the thread that started one is affected by it.
+	void begin_batch();
+	void end_batch();
+
+	void wait_and_flush() {
 		ERR_FAIL_COND(!sync);
 		sync->wait();
-		flush_one();
+		flush_all();
 	}
 
 	void flush_all() {
 		//ERR_FAIL_COND(sync);
-		lock();
-		while (flush_one(false)) {
+		while (flush_one()) {
 		}
-		unlock();
 	}
 
 	CommandQueueMT(bool p_sync);
@@ -111,8 +111,19 @@ private:
 	void _ref(const CowData &p_from);
 	void _copy_on_write();
 
+	// Takes over the data of p_from without touching the reference count.
+	_FORCE_INLINE_ void _move(CowData &p_from) {
+		if (_ptr == p_from._ptr) {
+			return; // self assign, do nothing.
+		}
+		_unref(_ptr);
+		_ptr = p_from._ptr;
+		p_from._ptr = nullptr;
+	}
+
 public:
 	void operator=(const CowData<T> &p_from) { _ref(p_from); }
+	void operator=(CowData<T> &&p_from) { _move(p_from); }
 
 	_FORCE_INLINE_ T *ptrw() {
 		_copy_on_write();
@@ -182,6 +193,10 @@ public:
 	_FORCE_INLINE_ CowData() {}
 	_FORCE_INLINE_ ~CowData();
 	_FORCE_INLINE_ CowData(CowData<T> &p_from) { _ref(p_from); };
+	_FORCE_INLINE_ CowData(CowData<T> &&p_from) {
+		_ptr = p_from._ptr;
+		p_from._ptr = nullptr;
+	}
 };
 
 template <class T>
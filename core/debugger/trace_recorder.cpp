@@ -0,0 +1,170 @@
+/*************************************************************************/
+/*  trace_recorder.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "trace_recorder.h"
+
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+
+std::atomic<bool> TraceRecorder::recording(false);
+std::atomic<uint32_t> TraceRecorder::writers(0);
+std::atomic<uint32_t> TraceRecorder::generation(1);
+uint32_t TraceRecorder::events_per_thread = TraceRecorder::DEFAULT_EVENTS_PER_THREAD;
+Mutex TraceRecorder::mutex;
+LocalVector<TraceRecorder::ThreadBuffer *> TraceRecorder::buffers;
+
+TraceRecorder::ThreadBuffer *TraceRecorder::_get_thread_buffer() {
+	// Buffers live until finish(), so each thread only has to look its own up once.
+	static thread_local ThreadBuffer *cached_buffer = nullptr;
+	static thread_local uint32_t cached_generation = 0;
+
+	uint32_t current_generation = generation.load(std::memory_order_acquire);
+	if (cached_buffer && cached_generation == current_generation) {
+		return cached_buffer;
+	}
+
+	MutexLock lock(mutex);
+
+	Thread::ID caller = Thread::get_caller_id();
+	ThreadBuffer *tb = nullptr;
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		// Thread IDs may be reused once a thread exits, so is its buffer.
+		if (buffers[i]->thread == caller) {
+			tb = buffers[i];
+			break;
+		}
+	}
+
+	if (!tb) {
+		tb = memnew(ThreadBuffer);
+		tb->thread = caller;
+		tb->events.resize(events_per_thread);
+		buffers.push_back(tb);
+	}
+
+	cached_buffer = tb;
+	cached_generation = current_generation;
+	return tb;
+}
+
+uint64_t TraceRecorder::get_ticks_usec() {
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+void TraceRecorder::record(const char *p_name, uint64_t p_begin, uint64_t p_end) {
+	// The zone may have begun before stop() was called, so check again. Either
+	// stop() sees this thread in writers and waits, or this thread sees that
+	// recording is off; buffers are never touched once stop() returned.
+	writers.fetch_add(1, std::memory_order_seq_cst);
+	if (recording.load(std::memory_order_seq_cst)) {
+		ThreadBuffer *tb = _get_thread_buffer();
+
+		Event &e = tb->events[tb->written % tb->events.size()];
+		e.name = p_name;
+		e.begin = p_begin;
+		e.end = p_end;
+		tb->written++;
+	}
+	writers.fetch_sub(1, std::memory_order_release);
+}
+
+void TraceRecorder::start(uint32_t p_events_per_thread) {
+	ERR_FAIL_COND(p_events_per_thread == 0);
+
+	stop(); // No thread may write while the buffers are resized.
+
+	MutexLock lock(mutex);
+
+	events_per_thread = p_events_per_thread;
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		buffers[i]->events.resize(events_per_thread);
+		buffers[i]->written = 0;
+	}
+
+	recording.store(true, std::memory_order_release);
+}
+
+void TraceRecorder::stop() {
+	recording.store(false, std::memory_order_seq_cst);
+	while (writers.load(std::memory_order_acquire)) {
+		; // Only waits for events being written, which takes a few instructions.
+	}
+}
+
+Error TraceRecorder::save(const String &p_path) {
+	// Events being written are waited for, zones that are still open are left out.
+	stop();
+
+	MutexLock lock(mutex);
+
+	Error err;
+	FileAccess *f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Can't open trace file for writing: " + p_path + ".");
+
+	f->store_string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	bool first = true;
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		const ThreadBuffer *tb = buffers[i];
+		uint32_t capacity = tb->events.size();
+		uint64_t count = MIN(tb->written, (uint64_t)capacity);
+		if (count == 0) {
+			continue;
+		}
+
+		String thread_name = tb->thread == Thread::get_main_id() ? String("Main Thread") : "Thread " + itos(i);
+		f->store_string(vformat("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n", i, thread_name));
+		first = false;
+
+		// Oldest event first.
+		for (uint64_t j = tb->written - count; j < tb->written; j++) {
+			const Event &e = tb->events[j % capacity];
+			f->store_string(",\n{\"name\":\"" + String(e.name).json_escape() + "\",\"ph\":\"X\",\"pid\":1,\"tid\":" + itos(i) + ",\"ts\":" + itos(e.begin) + ",\"dur\":" + itos(e.end - e.begin) + "}");
+		}
+	}
+
+	f->store_string("\n]}\n");
+	f->close();
+	memdelete(f);
+
+	return OK;
+}
+
+void TraceRecorder::finish() {
+	stop();
+
+	MutexLock lock(mutex);
+
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		memdelete(buffers[i]);
+	}
+	buffers.clear();
+	generation.fetch_add(1, std::memory_order_release);
+}
@@ -0,0 +1,112 @@
+/*************************************************************************/
+/*  trace_recorder.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include "core/local_vector.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/ustring.h"
+
+#include <atomic>
+
+// Records timed zones of engine code into a ring buffer per thread, so the
+// last few seconds of frames can be saved as a Chrome trace (JSON), which
+// chrome://tracing, Perfetto and Tracy (through import-chrome) can open.
+//
+// Zones are placed with TRACE_ZONE("Name"), the name must be a string
+// literal. While recording is off a zone costs a single relaxed load.
+class TraceRecorder {
+public:
+	enum {
+		DEFAULT_EVENTS_PER_THREAD = 1 << 16
+	};
+
+private:
+	struct Event {
+		const char *name;
+		uint64_t begin; // usec
+		uint64_t end; // usec
+	};
+
+	struct ThreadBuffer {
+		Thread::ID thread = 0;
+		LocalVector<Event> events;
+		uint64_t written = 0; // events ever written, the ring position is written % events.size()
+	};
+
+	static std::atomic<bool> recording;
+	static std::atomic<uint32_t> writers; // Threads inside record(), stop() waits for them to leave.
+	static std::atomic<uint32_t> generation;
+	static uint32_t events_per_thread;
+	static Mutex mutex;
+	static LocalVector<ThreadBuffer *> buffers;
+
+	static ThreadBuffer *_get_thread_buffer();
+
+public:
+	_FORCE_INLINE_ static bool is_recording() { return recording.load(std::memory_order_relaxed); }
+
+	static uint64_t get_ticks_usec();
+	static void record(const char *p_name, uint64_t p_begin, uint64_t p_end);
+
+	static void start(uint32_t p_events_per_thread = DEFAULT_EVENTS_PER_THREAD);
+	static void stop();
+	static Error save(const String &p_path);
+	static void finish();
+};
+
+class TraceZone {
+	const char *name;
+	uint64_t begin;
+
+public:
+	_FORCE_INLINE_ explicit TraceZone(const char *p_name) {
+		if (unlikely(TraceRecorder::is_recording())) {
+			name = p_name;
+			begin = TraceRecorder::get_ticks_usec();
+		} else {
+			name = nullptr;
+		}
+	}
+
+	_FORCE_INLINE_ ~TraceZone() {
+		if (unlikely(name)) {
+			TraceRecorder::record(name, begin, TraceRecorder::get_ticks_usec());
+		}
+	}
+};
+
+#define _TRACE_ZONE_VAR_CONCAT(m_a, m_b) m_a##m_b
+#define _TRACE_ZONE_VAR(m_line) _TRACE_ZONE_VAR_CONCAT(_trace_zone_, m_line)
+#define TRACE_ZONE(m_name) TraceZone _TRACE_ZONE_VAR(__LINE__)(m_name)
+
+#endif // TRACE_RECORDER_H
@@ -30,30 +30,252 @@
 
 #include "dictionary.h"
 
-#include "core/ordered_hash_map.h"
+#include "core/hashfuncs.h"
+#include "core/local_vector.h"
 #include "core/safe_refcount.h"
 #include "core/variant.h"
 
+#define DICTIONARY_PAGE_BITS 3
+#define DICTIONARY_PAGE_SIZE (1 << DICTIONARY_PAGE_BITS)
+#define DICTIONARY_PAGE_MASK (DICTIONARY_PAGE_SIZE - 1)
+#define DICTIONARY_MIN_INDEX_CAPACITY 8
+#define DICTIONARY_INDEX_EMPTY -1
+
+// Entries are stored densely in insertion order, in small pages that never move, so
+// pointers to keys and values stay valid until an element is erased (erasing may
+// compact the entries). Lookups go through an open addressing index of entry
+// positions, using linear probing and backward shift deletion.
 struct DictionaryPrivate {
+	struct Entry {
+		Variant key;
+		Variant value;
+		uint32_t hash = 0;
+		bool erased = false;
+	};
+
 	SafeRefCount refcount;
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> variant_map;
-};
 
-void Dictionary::get_key_list(List<Variant> *p_keys) const {
-	if (_p->variant_map.empty()) {
-		return;
+	LocalVector<Entry *> pages;
+	uint32_t entry_count = 0; // Including erased entries.
+	uint32_t erased_count = 0;
+
+	int32_t *index = nullptr;
+	uint32_t index_capacity = 0;
+
+	_FORCE_INLINE_ Entry &get_entry(uint32_t p_pos) const {
+		return pages[p_pos >> DICTIONARY_PAGE_BITS][p_pos & DICTIONARY_PAGE_MASK];
+	}
+
+	_FORCE_INLINE_ uint32_t size() const {
+		return entry_count - erased_count;
+	}
+
+	// Returns the index slot holding p_key, or -1.
+	int32_t find_slot(const Variant &p_key, uint32_t p_hash) const {
+		if (!index) {
+			return -1;
+		}
+
+		uint32_t mask = index_capacity - 1;
+		for (uint32_t slot = p_hash & mask;; slot = (slot + 1) & mask) {
+			int32_t pos = index[slot];
+			if (pos == DICTIONARY_INDEX_EMPTY) {
+				return -1;
+			}
+			const Entry &e = get_entry(pos);
+			if (e.hash == p_hash && e.key.hash_compare(p_key)) {
+				return slot;
+			}
+		}
+	}
+
+	// Returns the entry position of p_key, or -1.
+	_FORCE_INLINE_ int32_t find(const Variant &p_key, uint32_t p_hash) const {
+		int32_t slot = find_slot(p_key, p_hash);
+		return slot < 0 ? -1 : index[slot];
+	}
+
+	_FORCE_INLINE_ int32_t find(const Variant &p_key) const {
+		return find(p_key, p_key.hash());
+	}
+
+	void index_insert(uint32_t p_pos, uint32_t p_hash) {
+		uint32_t mask = index_capacity - 1;
+		uint32_t slot = p_hash & mask;
+		while (index[slot] != DICTIONARY_INDEX_EMPTY) {
+			slot = (slot + 1) & mask;
+		}
+		index[slot] = p_pos;
+	}
+
+	void rehash(uint32_t p_capacity) {
+		if (index) {
+			memfree(index);
+		}
+		index_capacity = p_capacity;
+		index = (int32_t *)memalloc(sizeof(int32_t) * index_capacity);
+		for (uint32_t i = 0; i < index_capacity; i++) {
+			index[i] = DICTIONARY_INDEX_EMPTY;
+		}
+
+		for (uint32_t i = 0; i < entry_count; i++) {
+			const Entry &e = get_entry(i);
+			if (!e.erased) {
+				index_insert(i, e.hash);
+			}
+		}
+	}
+
+	// p_key must not be in the dictionary yet.
+	uint32_t insert(const Variant &p_key, uint32_t p_hash, const Variant &p_value) {
+		if ((size() + 1) * 4 > index_capacity * 3) {
+			rehash(MAX(index_capacity * 2, (uint32_t)DICTIONARY_MIN_INDEX_CAPACITY));
+		}
+
+		if ((entry_count >> DICTIONARY_PAGE_BITS) == pages.size()) {
+			pages.push_back(memnew_arr(Entry, DICTIONARY_PAGE_SIZE));
+		}
+
+		uint32_t pos = entry_count++;
+		Entry &e = get_entry(pos);
+		e.key = p_key;
+		e.value = p_value;
+		e.hash = p_hash;
+		e.erased = false;
+
+		index_insert(pos, p_hash);
+
+		return pos;
+	}
+
+	bool erase(const Variant &p_key) {
+		int32_t slot = find_slot(p_key, p_key.hash());
+		if (slot < 0) {
+			return false;
+		}
+
+		uint32_t pos = index[slot];
+
+		// Shift back the entries that probed past the freed slot.
+		uint32_t mask = index_capacity - 1;
+		uint32_t hole = slot;
+		for (uint32_t next = (hole + 1) & mask; index[next] != DICTIONARY_INDEX_EMPTY; next = (next + 1) & mask) {
+			uint32_t home = get_entry(index[next]).hash & mask;
+			if (((next - home) & mask) >= ((next - hole) & mask)) {
+				index[hole] = index[next];
+				hole = next;
+			}
+		}
+		index[hole] = DICTIONARY_INDEX_EMPTY;
+
+		Entry &e = get_entry(pos);
+		e.key = Variant();
+		e.value = Variant();
+		e.erased = true;
+		erased_count++;
+
+		// Trailing erased entries can just be dropped.
+		while (entry_count > 0 && get_entry(entry_count - 1).erased) {
+			get_entry(entry_count - 1).erased = false;
+			entry_count--;
+			erased_count--;
+		}
+
+		if (entry_count == 0) {
+			clear();
+		} else if (erased_count > DICTIONARY_PAGE_SIZE && erased_count * 2 > entry_count) {
+			compact();
+		}
+
+		return true;
 	}
 
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		p_keys->push_back(E.key());
+	// Removes the holes left by erased entries, keeping the order.
+	void compact() {
+		uint32_t to = 0;
+		for (uint32_t from = 0; from < entry_count; from++) {
+			Entry &src = get_entry(from);
+			if (src.erased) {
+				src.erased = false;
+				continue;
+			}
+			if (to != from) {
+				Entry &dst = get_entry(to);
+				dst.key = src.key;
+				dst.value = src.value;
+				dst.hash = src.hash;
+				src.key = Variant();
+				src.value = Variant();
+			}
+			to++;
+		}
+
+		entry_count = to;
+		erased_count = 0;
+
+		uint32_t page_count = (entry_count + DICTIONARY_PAGE_MASK) >> DICTIONARY_PAGE_BITS;
+		for (uint32_t i = page_count; i < pages.size(); i++) {
+			memdelete_arr(pages[i]);
+		}
+		pages.resize(page_count);
+
+		rehash(index_capacity);
+	}
+
+	_FORCE_INLINE_ int32_t next_valid(uint32_t p_from) const {
+		for (uint32_t i = p_from; i < entry_count; i++) {
+			if (!get_entry(i).erased) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	void clear() {
+		for (uint32_t i = 0; i < pages.size(); i++) {
+			memdelete_arr(pages[i]);
+		}
+		pages.clear();
+		entry_count = 0;
+		erased_count = 0;
+
+		if (index) {
+			memfree(index);
+			index = nullptr;
+		}
+		index_capacity = 0;
+	}
+
+	~DictionaryPrivate() {
+		clear();
+	}
+};
+
+void Dictionary::get_key_list(List<Variant> *p_keys) const {
+	for (uint32_t i = 0; i < _p->entry_count; i++) {
+		const DictionaryPrivate::Entry &e = _p->get_entry(i);
+		if (!e.erased) {
+			p_keys->push_back(e.key);
+		}
 	}
 }
 
 Variant Dictionary::get_key_at_index(int p_index) const {
+	if (p_index < 0 || p_index >= (int)_p->size()) {
+		return Variant();
+	}
+	if (_p->erased_count == 0) {
+		return _p->get_entry(p_index).key;
+	}
+
 	int index = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
+	for (uint32_t i = 0; i < _p->entry_count; i++) {
+		const DictionaryPrivate::Entry &e = _p->get_entry(i);
+		if (e.erased) {
+			continue;
+		}
 		if (index == p_index) {
-			return E.key();
+			return e.key;
 		}
 		index++;
 	}
@@ -62,10 +284,21 @@ Variant Dictionary::get_key_at_index(int p_index) const {
 }
 
 Variant Dictionary::get_value_at_index(int p_index) const {
+	if (p_index < 0 || p_index >= (int)_p->size()) {
+		return Variant();
+	}
+	if (_p->erased_count == 0) {
+		return _p->get_entry(p_index).value;
+	}
+
 	int index = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
+	for (uint32_t i = 0; i < _p->entry_count; i++) {
+		const DictionaryPrivate::Entry &e = _p->get_entry(i);
+		if (e.erased) {
+			continue;
+		}
 		if (index == p_index) {
-			return E.value();
+			return e.value;
 		}
 		index++;
 	}
@@ -74,38 +307,46 @@ Variant Dictionary::get_value_at_index(int p_index) const {
 }
 
 Variant &Dictionary::operator[](const Variant &p_key) {
-	return _p->variant_map[p_key];
+	uint32_t hash = p_key.hash();
+	int32_t pos = _p->find(p_key, hash);
+	if (pos < 0) {
+		// consistent with Map behaviour
+		pos = _p->insert(p_key, hash, Variant());
+	}
+	return _p->get_entry(pos).value;
 }
 
 const Variant &Dictionary::operator[](const Variant &p_key) const {
-	return _p->variant_map[p_key];
+	int32_t pos = _p->find(p_key);
+	CRASH_COND(pos < 0);
+	return _p->get_entry(pos).value;
 }
 
 const Variant *Dictionary::getptr(const Variant &p_key) const {
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstElement E = ((const OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
+	int32_t pos = _p->find(p_key);
 
-	if (!E) {
+	if (pos < 0) {
 		return nullptr;
 	}
-	return &E.get();
+	return &_p->get_entry(pos).value;
 }
 
 Variant *Dictionary::getptr(const Variant &p_key) {
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.find(p_key);
+	int32_t pos = _p->find(p_key);
 
-	if (!E) {
+	if (pos < 0) {
 		return nullptr;
 	}
-	return &E.get();
+	return &_p->get_entry(pos).value;
 }
 
 Variant Dictionary::get_valid(const Variant &p_key) const {
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstElement E = ((const OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
+	int32_t pos = _p->find(p_key);
 
-	if (!E) {
+	if (pos < 0) {
 		return Variant();
 	}
-	return E.get();
+	return _p->get_entry(pos).value;
 }
 
 Variant Dictionary::get(const Variant &p_key, const Variant &p_default) const {
@@ -118,15 +359,15 @@ Variant Dictionary::get(const Variant &p_key, const Variant &p_default) const {
 }
 
 int Dictionary::size() const {
-	return _p->variant_map.size();
+	return _p->size();
 }
 
 bool Dictionary::empty() const {
-	return !_p->variant_map.size();
+	return _p->size() == 0;
 }
 
 bool Dictionary::has(const Variant &p_key) const {
-	return _p->variant_map.has(p_key);
+	return _p->find(p_key) >= 0;
 }
 
 bool Dictionary::has_all(const Array &p_keys) const {
@@ -139,7 +380,7 @@ bool Dictionary::has_all(const Array &p_keys) const {
 }
 
 bool Dictionary::erase(const Variant &p_key) {
-	return _p->variant_map.erase(p_key);
+	return _p->erase(p_key);
 }
 
 bool Dictionary::operator==(const Dictionary &p_dictionary) const {
@@ -168,7 +409,7 @@ void Dictionary::_ref(const Dictionary &p_from) const {
 }
 
 void Dictionary::clear() {
-	_p->variant_map.clear();
+	_p->clear();
 }
 
 void Dictionary::_unref() const {
@@ -182,9 +423,12 @@ void Dictionary::_unref() const {
 uint32_t Dictionary::hash() const {
 	uint32_t h = hash_djb2_one_32(Variant::DICTIONARY);
 
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		h = hash_djb2_one_32(E.key().hash(), h);
-		h = hash_djb2_one_32(E.value().hash(), h);
+	for (uint32_t i = 0; i < _p->entry_count; i++) {
+		const DictionaryPrivate::Entry &e = _p->get_entry(i);
+		if (!e.erased) {
+			h = hash_djb2_one_32(e.hash, h);
+			h = hash_djb2_one_32(e.value.hash(), h);
+		}
 	}
 
 	return h;
@@ -192,16 +436,18 @@ uint32_t Dictionary::hash() const {
 
 Array Dictionary::keys() const {
 	Array varr;
-	if (_p->variant_map.empty()) {
+	if (_p->size() == 0) {
 		return varr;
 	}
 
 	varr.resize(size());
 
-	int i = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		varr[i] = E.key();
-		i++;
+	int idx = 0;
+	for (uint32_t i = 0; i < _p->entry_count; i++) {
+		const DictionaryPrivate::Entry &e = _p->get_entry(i);
+		if (!e.erased) {
+			varr[idx++] = e.key;
+		}
 	}
 
 	return varr;
@@ -209,42 +455,49 @@ Array Dictionary::keys() const {
 
 Array Dictionary::values() const {
 	Array varr;
-	if (_p->variant_map.empty()) {
+	if (_p->size() == 0) {
 		return varr;
 	}
 
 	varr.resize(size());
 
-	int i = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		varr[i] = E.get();
-		i++;
+	int idx = 0;
+	for (uint32_t i = 0; i < _p->entry_count; i++) {
+		const DictionaryPrivate::Entry &e = _p->get_entry(i);
+		if (!e.erased) {
+			varr[idx++] = e.value;
+		}
 	}
 
 	return varr;
 }
 
 const Variant *Dictionary::next(const Variant *p_key) const {
+	int32_t pos;
 	if (p_key == nullptr) {
 		// caller wants to get the first element
-		if (_p->variant_map.front()) {
-			return &_p->variant_map.front().key();
+		pos = _p->next_valid(0);
+	} else {
+		pos = _p->find(*p_key);
+		if (pos >= 0) {
+			pos = _p->next_valid(pos + 1);
 		}
-		return nullptr;
 	}
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.find(*p_key);
 
-	if (E && E.next()) {
-		return &E.next().key();
+	if (pos < 0) {
+		return nullptr;
 	}
-	return nullptr;
+	return &_p->get_entry(pos).key;
 }
 
 Dictionary Dictionary::duplicate(bool p_deep) const {
 	Dictionary n;
 
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		n[E.key()] = p_deep ? E.value().duplicate(true) : E.value();
+	for (uint32_t i = 0; i < _p->entry_count; i++) {
+		const DictionaryPrivate::Entry &e = _p->get_entry(i);
+		if (!e.erased) {
+			n._p->insert(e.key, e.hash, p_deep ? e.value.duplicate(true) : e.value);
+		}
 	}
 
 	return n;
@@ -255,7 +508,7 @@ void Dictionary::operator=(const Dictionary &p_dictionary) {
 }
 
 const void *Dictionary::id() const {
-	return _p->variant_map.id();
+	return _p;
 }
 
 Dictionary::Dictionary(const Dictionary &p_from) {
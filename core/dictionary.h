@@ -50,6 +50,8 @@ public:
 	Variant get_key_at_index(int p_index) const;
 	Variant get_value_at_index(int p_index) const;
 
+	// Pointers returned by operator[], getptr() and next() stay valid while entries
+	// are added, but erase() may move the remaining entries and invalidate them all.
 	Variant &operator[](const Variant &p_key);
 	const Variant &operator[](const Variant &p_key) const;
 
@@ -30,6 +30,7 @@
 
 #include "resource_loader.h"
 
+#include "core/debugger/trace_recorder.h"
 #include "core/io/resource_importer.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
@@ -504,6 +505,8 @@ RES ResourceLoader::load_threaded_get(const String &p_path, Error *r_error) {
 }
 
 RES ResourceLoader::load(const String &p_path, const String &p_type_hint, bool p_no_cache, Error *r_error) {
+	TRACE_ZONE("ResourceLoader::load");
+
 	if (r_error) {
 		*r_error = ERR_CANT_OPEN;
 	}
@@ -267,7 +267,6 @@ int AStar::get_point_capacity() const {
 
 void AStar::reserve_space(int p_num_nodes) {
 	ERR_FAIL_COND_MSG(p_num_nodes <= 0, "New capacity must be greater than 0, was: " + itos(p_num_nodes) + ".");
-	ERR_FAIL_COND_MSG((uint32_t)p_num_nodes < points.get_capacity(), "New capacity must be greater than current capacity: " + itos(points.get_capacity()) + ", new was: " + itos(p_num_nodes) + ".");
 	points.reserve(p_num_nodes);
 }
 
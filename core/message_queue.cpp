@@ -31,86 +31,215 @@
 #include "message_queue.h"
 
 #include "core/core_string_names.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/project_settings.h"
 #include "core/script_language.h"
 
 MessageQueue *MessageQueue::singleton = nullptr;
 
+static std::atomic<uint32_t> message_queue_generation(0);
+
+// Per thread cache of the thread's buffer. Its destructor runs when the
+// thread exits, which lets flush() free the buffer once it is drained.
+struct MessageQueueThreadCache {
+	MessageQueue::ThreadBuffer *buffer = nullptr;
+	uint32_t generation = 0;
+
+	~MessageQueueThreadCache() {
+		if (buffer) {
+			MessageQueue::_thread_exited(buffer, generation);
+		}
+	}
+};
+
 MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
-Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
-	return push_callable(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
+void MessageQueue::_grow(Buffer &p_buffer, uint32_t p_size) {
+	uint8_t *new_data = (uint8_t *)memalloc(p_size);
+	ERR_FAIL_COND(!new_data);
+
+	// Messages hold Callables and Variants, which can't be moved around as raw bytes.
+	uint32_t pos = 0;
+	while (pos < p_buffer.end) {
+		Message *message = (Message *)&p_buffer.data[pos];
+		uint32_t size = _message_size(message);
+
+		Message *new_message = memnew_placement(&new_data[pos], Message(*message));
+		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+			Variant *args = (Variant *)(message + 1);
+			Variant *new_args = (Variant *)(new_message + 1);
+			for (int i = 0; i < message->args; i++) {
+				memnew_placement(&new_args[i], Variant(args[i]));
+				args[i].~Variant();
+			}
+		}
+		message->~Message();
+
+		pos += size;
+	}
+
+	if (p_buffer.data) {
+		memfree(p_buffer.data);
+	}
+	p_buffer.data = new_data;
+	p_buffer.size = p_size;
 }
 
-Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, VARIANT_ARG_DECLARE) {
-	VARIANT_ARGPTRS;
+uint8_t *MessageQueue::_allocate(Buffer &p_buffer, uint32_t p_size, uint32_t p_min_size) {
+	if (p_buffer.end + p_size > p_buffer.size) {
+		_grow(p_buffer, next_power_of_2(MAX(p_buffer.end + p_size, p_min_size)));
+		ERR_FAIL_COND_V(p_buffer.end + p_size > p_buffer.size, nullptr);
+	}
 
-	int argc = 0;
+	uint8_t *ptr = &p_buffer.data[p_buffer.end];
+	p_buffer.end += p_size;
+	return ptr;
+}
 
-	for (int i = 0; i < VARIANT_ARG_MAX; i++) {
-		if (argptr[i]->get_type() == Variant::NIL) {
-			break;
+uint32_t MessageQueue::_message_size(const Message *p_message) {
+	uint32_t size = sizeof(Message);
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		size += sizeof(Variant) * p_message->args;
+	}
+	return size;
+}
+
+void MessageQueue::_clear_buffer(Buffer &p_buffer) {
+	uint32_t read_pos = 0;
+
+	while (read_pos < p_buffer.end) {
+		Message *message = (Message *)&p_buffer.data[read_pos];
+		read_pos += _message_size(message);
+
+		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+			Variant *args = (Variant *)(message + 1);
+			for (int i = 0; i < message->args; i++) {
+				args[i].~Variant();
+			}
 		}
-		argc++;
+		message->~Message();
 	}
 
-	return push_call(p_id, p_method, argptr, argc, false);
+	p_buffer.end = 0;
 }
 
-Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+MessageQueue::ThreadBuffer *MessageQueue::_get_thread_buffer() {
+	Thread::ID caller = Thread::get_caller_id();
+	if (caller == Thread::get_main_id()) {
+		return &main_buffer;
+	}
+
+	// Worker threads cache their buffer, so only the first push of each
+	// thread has to take the queue mutex.
+	static thread_local MessageQueueThreadCache cache;
+
+	if (cache.buffer && cache.generation == generation) {
+		return cache.buffer;
+	}
+
 	_THREAD_SAFE_METHOD_
 
-	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
+	ThreadBuffer *tb = nullptr;
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		// Thread IDs may be reused once a thread exits, but not the buffer of the exited thread.
+		if (thread_buffers[i]->thread == caller && !thread_buffers[i]->exited) {
+			tb = thread_buffers[i];
+			break;
+		}
+	}
+
+	if (!tb) {
+		tb = memnew(ThreadBuffer);
+		tb->thread = caller;
+		thread_buffers.push_back(tb);
+	}
+
+	cache.buffer = tb;
+	cache.generation = generation;
+	return tb;
+}
+
+void MessageQueue::_thread_exited(ThreadBuffer *p_buffer, uint32_t p_generation) {
+	MessageQueue *mq = singleton;
+	if (!mq || mq->generation != p_generation) {
+		return; // The buffer belonged to a queue that no longer exists.
+	}
+
+	MutexLock lock(mq->_thread_safe_);
+	p_buffer->exited = true;
+}
+
+Error MessageQueue::_push_message(const Callable &p_callable, int16_t p_type, int p_notification, const Variant **p_args, int p_argcount) {
+	ThreadBuffer *tb = _get_thread_buffer();
+	bool is_main = tb == &main_buffer;
+	uint32_t min_size = is_main ? buffer_size : THREAD_QUEUE_SIZE_KB * 1024;
 
-	if ((buffer_end + room_needed) >= buffer_size) {
-		String type;
-		if (ObjectDB::get_instance(p_id)) {
-			type = ObjectDB::get_instance(p_id)->get_class();
+	if (!is_main) {
+		tb->lock.lock();
+	}
+
+	uint8_t *ptr = _allocate(tb->write, sizeof(Message) + sizeof(Variant) * p_argcount, min_size);
+	if (!ptr) {
+		if (!is_main) {
+			tb->lock.unlock();
 		}
-		print_line("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
+		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
-	msg->args = 1;
-	msg->callable = Callable(p_id, p_prop);
-	msg->type = TYPE_SET;
+	Message *msg = memnew_placement(ptr, Message);
+	msg->callable = p_callable;
+	msg->type = p_type;
+	if ((p_type & FLAG_MASK) == TYPE_NOTIFICATION) {
+		msg->notification = p_notification;
+	} else {
+		msg->args = p_argcount;
+	}
+	msg->order = order.fetch_add(1, std::memory_order_relaxed);
 
-	buffer_end += sizeof(Message);
+	Variant *args = (Variant *)(msg + 1);
+	for (int i = 0; i < p_argcount; i++) {
+		memnew_placement(&args[i], Variant);
+		args[i] = *p_args[i];
+	}
 
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
-	*v = p_value;
+	if (!is_main) {
+		tb->lock.unlock();
+	}
 
 	return OK;
 }
 
-Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
-	_THREAD_SAFE_METHOD_
+Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return push_callable(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
+}
 
-	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
+Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, VARIANT_ARG_DECLARE) {
+	VARIANT_ARGPTRS;
 
-	uint8_t room_needed = sizeof(Message);
+	int argc = 0;
 
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
+	for (int i = 0; i < VARIANT_ARG_MAX; i++) {
+		if (argptr[i]->get_type() == Variant::NIL) {
+			break;
+		}
+		argc++;
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	return push_call(p_id, p_method, argptr, argc, false);
+}
 
-	msg->type = TYPE_NOTIFICATION;
-	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
-	//msg->target;
-	msg->notification = p_notification;
+Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	const Variant *argptr = &p_value;
+	return _push_message(Callable(p_id, p_prop), TYPE_SET, 0, &argptr, 1);
+}
 
-	buffer_end += sizeof(Message);
+Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
+	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
 
-	return OK;
+	//name is meaningless but callable needs it
+	return _push_message(Callable(p_id, CoreStringNames::get_singleton()->notification), TYPE_NOTIFICATION, p_notification, nullptr, 0);
 }
 
 Error MessageQueue::push_call(Object *p_object, const StringName &p_method, VARIANT_ARG_DECLARE) {
@@ -126,33 +255,12 @@ Error MessageQueue::push_set(Object *p_object, const StringName &p_prop, const V
 }
 
 Error MessageQueue::push_callable(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
-	_THREAD_SAFE_METHOD_
-
-	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
-
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed method: " + p_callable);
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
-	}
-
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
-	msg->args = p_argcount;
-	msg->callable = p_callable;
-	msg->type = TYPE_CALL;
+	int16_t type = TYPE_CALL;
 	if (p_show_error) {
-		msg->type |= FLAG_SHOW_ERROR;
-	}
-
-	buffer_end += sizeof(Message);
-
-	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
-		*v = *p_args[i];
+		type |= FLAG_SHOW_ERROR;
 	}
 
-	return OK;
+	return _push_message(p_callable, type, 0, p_args, p_argcount);
 }
 
 void MessageQueue::statistics() {
@@ -160,56 +268,71 @@ void MessageQueue::statistics() {
 	Map<int, int> notify_count;
 	Map<Callable, int> call_count;
 	int null_count = 0;
+	uint32_t total_bytes = 0;
 
-	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+	_THREAD_SAFE_LOCK_
 
-		Object *target = message->callable.get_object();
+	for (uint32_t i = 0; i <= thread_buffers.size(); i++) {
+		// Index 0 is the main thread, which is the only one allowed to call this.
+		ThreadBuffer *tb = i == 0 ? &main_buffer : thread_buffers[i - 1];
+		if (tb != &main_buffer) {
+			tb->lock.lock();
+		}
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					if (!call_count.has(message->callable)) {
-						call_count[message->callable] = 0;
-					}
+		uint32_t read_pos = 0;
+		while (read_pos < tb->write.end) {
+			Message *message = (Message *)&tb->write.data[read_pos];
 
-					call_count[message->callable]++;
+			Object *target = message->callable.get_object();
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					if (!notify_count.has(message->notification)) {
-						notify_count[message->notification] = 0;
-					}
+			if (target != nullptr) {
+				switch (message->type & FLAG_MASK) {
+					case TYPE_CALL: {
+						if (!call_count.has(message->callable)) {
+							call_count[message->callable] = 0;
+						}
 
-					notify_count[message->notification]++;
+						call_count[message->callable]++;
 
-				} break;
-				case TYPE_SET: {
-					StringName t = message->callable.get_method();
-					if (!set_count.has(t)) {
-						set_count[t] = 0;
-					}
+					} break;
+					case TYPE_NOTIFICATION: {
+						if (!notify_count.has(message->notification)) {
+							notify_count[message->notification] = 0;
+						}
 
-					set_count[t]++;
+						notify_count[message->notification]++;
 
-				} break;
-			}
+					} break;
+					case TYPE_SET: {
+						StringName t = message->callable.get_method();
+						if (!set_count.has(t)) {
+							set_count[t] = 0;
+						}
+
+						set_count[t]++;
+
+					} break;
+				}
 
-		} else {
-			//object was deleted
-			print_line("Object was deleted while awaiting a callback");
+			} else {
+				//object was deleted
+				print_line("Object was deleted while awaiting a callback");
 
-			null_count++;
+				null_count++;
+			}
+
+			read_pos += _message_size(message);
 		}
+		total_bytes += tb->write.end;
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+		if (tb != &main_buffer) {
+			tb->lock.unlock();
 		}
 	}
 
-	print_line("TOTAL BYTES: " + itos(buffer_end));
+	_THREAD_SAFE_UNLOCK_
+
+	print_line("TOTAL BYTES: " + itos(total_bytes));
 	print_line("NULL count: " + itos(null_count));
 
 	for (Map<StringName, int>::Element *E = set_count.front(); E; E = E->next()) {
@@ -246,78 +369,144 @@ void MessageQueue::_call_function(const Callable &p_callable, const Variant *p_a
 	}
 }
 
-void MessageQueue::flush() {
-	if (buffer_end > buffer_max_used) {
-		buffer_max_used = buffer_end;
+void MessageQueue::_process_message(Message *p_message) {
+	Object *target = p_message->callable.get_object();
+
+	if (target != nullptr) {
+		switch (p_message->type & FLAG_MASK) {
+			case TYPE_CALL: {
+				Variant *args = (Variant *)(p_message + 1);
+
+				// messages don't expect a return value
+
+				_call_function(p_message->callable, args, p_message->args, p_message->type & FLAG_SHOW_ERROR);
+
+			} break;
+			case TYPE_NOTIFICATION: {
+				// messages don't expect a return value
+				target->notification(p_message->notification);
+
+			} break;
+			case TYPE_SET: {
+				Variant *arg = (Variant *)(p_message + 1);
+				// messages don't expect a return value
+				target->set(p_message->callable.get_method(), *arg);
+
+			} break;
+		}
 	}
 
-	uint32_t read_pos = 0;
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int i = 0; i < p_message->args; i++) {
+			args[i].~Variant();
+		}
+	}
 
-	//using reverse locking strategy
-	_THREAD_SAFE_LOCK_
+	p_message->~Message();
+}
 
-	if (flushing) {
-		_THREAD_SAFE_UNLOCK_
-		ERR_FAIL_COND(flushing); //already flushing, you did something odd
+uint32_t MessageQueue::_swap_buffers(LocalVector<ThreadBuffer *> &r_active) {
+	uint32_t total = 0;
+	r_active.clear();
+
+	SWAP(main_buffer.write, main_buffer.read);
+	main_buffer.read_pos = 0;
+	if (main_buffer.read.end) {
+		r_active.push_back(&main_buffer);
+		total += main_buffer.read.end;
 	}
-	flushing = true;
 
-	while (read_pos < buffer_end) {
-		//lock on each iteration, so a call can re-add itself to the message queue
+	_THREAD_SAFE_LOCK_
 
-		Message *message = (Message *)&buffer[read_pos];
+	// Order numbers are taken under the buffer lock, so with every buffer locked at
+	// once this round gets exactly the messages pushed so far, and none pushed later.
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		thread_buffers[i]->lock.lock();
+	}
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		SWAP(thread_buffers[i]->write, thread_buffers[i]->read);
+	}
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		thread_buffers[i]->lock.unlock();
+	}
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		ThreadBuffer *tb = thread_buffers[i];
+		tb->read_pos = 0;
+		if (tb->read.end) {
+			r_active.push_back(tb);
+			total += tb->read.end;
+		} else if (tb->exited && tb->write.end == 0) {
+			// Nothing left from a thread that is gone.
+			if (tb->write.data) {
+				memfree(tb->write.data);
+			}
+			if (tb->read.data) {
+				memfree(tb->read.data);
+			}
+			memdelete(tb);
+			thread_buffers.remove(i);
+			i--;
 		}
+	}
 
-		//pre-advance so this function is reentrant
-		read_pos += advance;
-
-		_THREAD_SAFE_UNLOCK_
+	_THREAD_SAFE_UNLOCK_
 
-		Object *target = message->callable.get_object();
+	return total;
+}
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					Variant *args = (Variant *)(message + 1);
+void MessageQueue::flush() {
+	ERR_FAIL_COND_MSG(Thread::get_caller_id() != Thread::get_main_id(), "The message queue can only be flushed from the main thread.");
+	ERR_FAIL_COND(flushing); //already flushing, you did something odd
 
-					// messages don't expect a return value
+	TRACE_ZONE("MessageQueue::flush");
 
-					_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
+	flushing = true;
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					// messages don't expect a return value
-					target->notification(message->notification);
+	LocalVector<ThreadBuffer *> active;
 
-				} break;
-				case TYPE_SET: {
-					Variant *arg = (Variant *)(message + 1);
-					// messages don't expect a return value
-					target->set(message->callable.get_method(), *arg);
+	// Messages pushed while flushing (including from the calls themselves)
+	// land in the write buffers and are picked up by the next round.
+	while (uint32_t total = _swap_buffers(active)) {
+		if (total > buffer_max_used) {
+			buffer_max_used = total;
+		}
 
-				} break;
+		while (true) {
+			// Merge the buffers back into push order. Each buffer is already
+			// ordered, so this only needs to look at the head of each one.
+			ThreadBuffer *next = nullptr;
+			Message *message = nullptr;
+
+			for (uint32_t i = 0; i < active.size(); i++) {
+				ThreadBuffer *tb = active[i];
+				if (tb->read_pos >= tb->read.end) {
+					continue;
+				}
+				Message *m = (Message *)&tb->read.data[tb->read_pos];
+				if (!message || int32_t(m->order - message->order) < 0) {
+					next = tb;
+					message = m;
+				}
 			}
-		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int i = 0; i < message->args; i++) {
-				args[i].~Variant();
+			if (!next) {
+				break;
 			}
-		}
 
-		message->~Message();
+			//pre-advance so this function is reentrant
+			next->read_pos += _message_size(message);
+
+			_process_message(message);
+		}
 
-		_THREAD_SAFE_LOCK_
+		for (uint32_t i = 0; i < active.size(); i++) {
+			active[i]->read.end = 0;
+		}
 	}
 
-	buffer_end = 0; // reset buffer
 	flushing = false;
-	_THREAD_SAFE_UNLOCK_
 }
 
 bool MessageQueue::is_flushing() const {
@@ -328,32 +517,38 @@ MessageQueue::MessageQueue() {
 	ERR_FAIL_COND_MSG(singleton != nullptr, "A MessageQueue singleton already exists.");
 	singleton = this;
 
+	order.store(0);
+	generation = message_queue_generation.fetch_add(1) + 1;
+
 	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
 	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater"));
 	buffer_size *= 1024;
-	buffer = memnew_arr(uint8_t, buffer_size);
+
+	// Preallocate both main thread buffers, so a steady workload never reallocates.
+	_allocate(main_buffer.write, buffer_size, buffer_size);
+	_allocate(main_buffer.read, buffer_size, buffer_size);
+	main_buffer.write.end = 0;
+	main_buffer.read.end = 0;
 }
 
 MessageQueue::~MessageQueue() {
-	uint32_t read_pos = 0;
-
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
-		Variant *args = (Variant *)(message + 1);
-		int argc = message->args;
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			for (int i = 0; i < argc; i++) {
-				args[i].~Variant();
-			}
+	_clear_buffer(main_buffer.write);
+	_clear_buffer(main_buffer.read);
+	memfree(main_buffer.write.data);
+	memfree(main_buffer.read.data);
+
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		ThreadBuffer *tb = thread_buffers[i];
+		_clear_buffer(tb->write);
+		_clear_buffer(tb->read);
+		if (tb->write.data) {
+			memfree(tb->write.data);
 		}
-		message->~Message();
-
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+		if (tb->read.data) {
+			memfree(tb->read.data);
 		}
+		memdelete(tb);
 	}
 
 	singleton = nullptr;
-	memdelete_arr(buffer);
 }
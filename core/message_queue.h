@@ -31,15 +31,21 @@
 #ifndef MESSAGE_QUEUE_H
 #define MESSAGE_QUEUE_H
 
+#include "core/local_vector.h"
 #include "core/object.h"
+#include "core/os/thread.h"
 #include "core/os/thread_safe.h"
+#include "core/spin_lock.h"
+
+#include <atomic>
 
 class MessageQueue {
 	_THREAD_SAFE_CLASS_
 
 	enum {
 
-		DEFAULT_QUEUE_SIZE_KB = 1024
+		DEFAULT_QUEUE_SIZE_KB = 1024,
+		THREAD_QUEUE_SIZE_KB = 16
 	};
 
 	enum {
@@ -58,14 +64,51 @@ class MessageQueue {
 			int16_t notification;
 			int16_t args;
 		};
+		uint32_t order; // Global push order, used to merge the per-thread buffers on flush.
+	};
+
+	// Messages are stored inline, each followed by its arguments. Buffers
+	// grow on demand instead of failing when full.
+	struct Buffer {
+		uint8_t *data = nullptr;
+		uint32_t end = 0;
+		uint32_t size = 0;
+	};
+
+	// Every producer thread appends to its own write buffer. flush() swaps it
+	// with the read buffer and drains the latter, so producers only contend
+	// with the flush for the duration of the swap. The main thread buffer is
+	// only ever touched from the main thread and is not locked at all.
+	struct ThreadBuffer {
+		SpinLock lock;
+		Thread::ID thread = 0;
+		Buffer write;
+		Buffer read;
+		uint32_t read_pos = 0;
+		bool exited = false; // The thread is gone, the buffer is freed once drained.
 	};
 
-	uint8_t *buffer;
-	uint32_t buffer_end = 0;
+	friend struct MessageQueueThreadCache;
+
+	ThreadBuffer main_buffer;
+	LocalVector<ThreadBuffer *> thread_buffers;
+	std::atomic<uint32_t> order;
+	uint32_t generation = 0;
+
 	uint32_t buffer_max_used = 0;
 	uint32_t buffer_size;
 
+	ThreadBuffer *_get_thread_buffer();
+	Error _push_message(const Callable &p_callable, int16_t p_type, int p_notification, const Variant **p_args, int p_argcount);
+	static uint8_t *_allocate(Buffer &p_buffer, uint32_t p_size, uint32_t p_min_size);
+	static void _grow(Buffer &p_buffer, uint32_t p_size);
+	static uint32_t _message_size(const Message *p_message);
+	static void _thread_exited(ThreadBuffer *p_buffer, uint32_t p_generation);
+	static void _clear_buffer(Buffer &p_buffer);
+	uint32_t _swap_buffers(LocalVector<ThreadBuffer *> &r_active);
+
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
+	void _process_message(Message *p_message);
 
 	static MessageQueue *singleton;
 
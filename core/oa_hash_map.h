@@ -43,19 +43,26 @@
  * and enables faster lookups. Backward shift deletion is employed to further
  * improve the performance and to avoid infinite loops in rare cases.
  *
+ * The hashes are kept in their own array, so probing only touches keys whose
+ * hash already matched. The capacity is always a power of two.
+ *
  * The entries are stored inplace, so huge keys or values might fill cache lines
- * a lot faster.
+ * a lot faster. Unlike HashMap, pointers to values are invalidated by inserting
+ * or removing entries.
+ *
+ * Nothing is allocated until the first insertion, so empty (and static) maps
+ * are free.
  */
 template <class TKey, class TValue,
 		class Hasher = HashMapHasherDefault,
 		class Comparator = HashMapComparatorDefault<TKey>>
 class OAHashMap {
 private:
-	TValue *values;
-	TKey *keys;
-	uint32_t *hashes;
+	TValue *values = nullptr;
+	TKey *keys = nullptr;
+	uint32_t *hashes = nullptr;
 
-	uint32_t capacity;
+	uint32_t capacity = 0;
 
 	uint32_t num_elements = 0;
 
@@ -72,8 +79,8 @@ private:
 	}
 
 	_FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash) const {
-		uint32_t original_pos = p_hash % capacity;
-		return (p_pos - original_pos + capacity) % capacity;
+		uint32_t original_pos = p_hash & (capacity - 1);
+		return (p_pos - original_pos) & (capacity - 1);
 	}
 
 	_FORCE_INLINE_ void _construct(uint32_t p_pos, uint32_t p_hash, const TKey &p_key, const TValue &p_value) {
@@ -85,8 +92,12 @@ private:
 	}
 
 	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (num_elements == 0) {
+			return false;
+		}
+
 		uint32_t hash = _hash(p_key);
-		uint32_t pos = hash % capacity;
+		uint32_t pos = hash & (capacity - 1);
 		uint32_t distance = 0;
 
 		while (true) {
@@ -103,7 +114,7 @@ private:
 				return true;
 			}
 
-			pos = (pos + 1) % capacity;
+			pos = (pos + 1) & (capacity - 1);
 			distance++;
 		}
 	}
@@ -111,7 +122,7 @@ private:
 	void _insert_with_hash(uint32_t p_hash, const TKey &p_key, const TValue &p_value) {
 		uint32_t hash = p_hash;
 		uint32_t distance = 0;
-		uint32_t pos = hash % capacity;
+		uint32_t pos = hash & (capacity - 1);
 
 		TKey key = p_key;
 		TValue value = p_value;
@@ -132,27 +143,38 @@ private:
 				distance = existing_probe_len;
 			}
 
-			pos = (pos + 1) % capacity;
+			pos = (pos + 1) & (capacity - 1);
 			distance++;
 		}
 	}
 
+	// Keys and values are only constructed for occupied slots.
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+
+		keys = static_cast<TKey *>(memalloc(sizeof(TKey) * capacity));
+		values = static_cast<TValue *>(memalloc(sizeof(TValue) * capacity));
+		hashes = static_cast<uint32_t *>(memalloc(sizeof(uint32_t) * capacity));
+
+		for (uint32_t i = 0; i < capacity; i++) {
+			hashes[i] = EMPTY_HASH;
+		}
+	}
+
 	void _resize_and_rehash(uint32_t p_new_capacity) {
+		if (!hashes) {
+			capacity = p_new_capacity; // Allocated on the first insertion.
+			return;
+		}
+
 		uint32_t old_capacity = capacity;
-		capacity = p_new_capacity;
 
 		TKey *old_keys = keys;
 		TValue *old_values = values;
 		uint32_t *old_hashes = hashes;
 
 		num_elements = 0;
-		keys = memnew_arr(TKey, capacity);
-		values = memnew_arr(TValue, capacity);
-		hashes = memnew_arr(uint32_t, capacity);
-
-		for (uint32_t i = 0; i < capacity; i++) {
-			hashes[i] = 0;
-		}
+		_allocate(p_new_capacity);
 
 		for (uint32_t i = 0; i < old_capacity; i++) {
 			if (old_hashes[i] == EMPTY_HASH) {
@@ -160,11 +182,13 @@ private:
 			}
 
 			_insert_with_hash(old_hashes[i], old_keys[i], old_values[i]);
+			old_keys[i].~TKey();
+			old_values[i].~TValue();
 		}
 
-		memdelete_arr(old_keys);
-		memdelete_arr(old_values);
-		memdelete_arr(old_hashes);
+		memfree(old_keys);
+		memfree(old_values);
+		memfree(old_hashes);
 	}
 
 	void _resize_and_rehash() {
@@ -174,12 +198,17 @@ private:
 public:
 	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
 	_FORCE_INLINE_ uint32_t get_num_elements() const { return num_elements; }
+	_FORCE_INLINE_ int size() const { return num_elements; }
 
 	bool empty() const {
 		return num_elements == 0;
 	}
 
 	void clear() {
+		if (num_elements == 0) {
+			return;
+		}
+
 		for (uint32_t i = 0; i < capacity; i++) {
 			if (hashes[i] == EMPTY_HASH) {
 				continue;
@@ -194,7 +223,12 @@ public:
 	}
 
 	void insert(const TKey &p_key, const TValue &p_value) {
-		if (num_elements + 1 > 0.9 * capacity) {
+		if (unlikely(!hashes)) {
+			_allocate(capacity);
+		}
+
+		// Keep the load factor under 90%.
+		if ((num_elements + 1) * 10 > capacity * 9) {
 			_resize_and_rehash();
 		}
 
@@ -208,8 +242,7 @@ public:
 		bool exists = _lookup_pos(p_key, pos);
 
 		if (exists) {
-			values[pos].~TValue();
-			memnew_placement(&values[pos], TValue(p_data));
+			values[pos] = p_data;
 		} else {
 			insert(p_key, p_data);
 		}
@@ -226,8 +259,7 @@ public:
 		bool exists = _lookup_pos(p_key, pos);
 
 		if (exists) {
-			r_data.~TValue();
-			memnew_placement(&r_data, TValue(values[pos]));
+			r_data = values[pos];
 			return true;
 		}
 
@@ -235,10 +267,9 @@ public:
 	}
 
 	/**
-	 * returns true if the value was found, false otherwise.
+	 * returns a pointer to the value if found, nullptr otherwise.
 	 *
-	 * if r_data is not nullptr  then the value will be written to the object
-	 * it points to.
+	 * the pointer is only valid until the map is modified.
 	 */
 	TValue *lookup_ptr(const TKey &p_key) const {
 		uint32_t pos = 0;
@@ -250,27 +281,32 @@ public:
 		return nullptr;
 	}
 
+	// Same as lookup_ptr(), for code written against HashMap.
+	_FORCE_INLINE_ TValue *getptr(const TKey &p_key) const {
+		return lookup_ptr(p_key);
+	}
+
 	_FORCE_INLINE_ bool has(const TKey &p_key) const {
 		uint32_t _pos = 0;
 		return _lookup_pos(p_key, _pos);
 	}
 
-	void remove(const TKey &p_key) {
+	bool erase(const TKey &p_key) {
 		uint32_t pos = 0;
 		bool exists = _lookup_pos(p_key, pos);
 
 		if (!exists) {
-			return;
+			return false;
 		}
 
-		uint32_t next_pos = (pos + 1) % capacity;
+		uint32_t next_pos = (pos + 1) & (capacity - 1);
 		while (hashes[next_pos] != EMPTY_HASH &&
 				_get_probe_length(next_pos, hashes[next_pos]) != 0) {
 			SWAP(hashes[next_pos], hashes[pos]);
 			SWAP(keys[next_pos], keys[pos]);
 			SWAP(values[next_pos], values[pos]);
 			pos = next_pos;
-			next_pos = (pos + 1) % capacity;
+			next_pos = (pos + 1) & (capacity - 1);
 		}
 
 		hashes[pos] = EMPTY_HASH;
@@ -278,16 +314,24 @@ public:
 		keys[pos].~TKey();
 
 		num_elements--;
+		return true;
+	}
+
+	_FORCE_INLINE_ void remove(const TKey &p_key) {
+		erase(p_key);
 	}
 
 	/**
 	 * reserves space for a number of elements, useful to avoid many resizes and rehashes
-	 *  if adding a known (possibly large) number of elements at once, must be larger than old
-	 *  capacity.
+	 *  if adding a known (possibly large) number of elements at once. The capacity is
+	 *  rounded up to the next power of two, requests that fit in it do nothing.
 	 **/
 	void reserve(uint32_t p_new_capacity) {
-		ERR_FAIL_COND(p_new_capacity < capacity);
-		_resize_and_rehash(p_new_capacity);
+		uint32_t new_capacity = next_power_of_2(p_new_capacity);
+		if (new_capacity <= capacity) {
+			return;
+		}
+		_resize_and_rehash(new_capacity);
 	}
 
 	struct Iterator {
@@ -304,8 +348,10 @@ public:
 	Iterator iter() const {
 		Iterator it;
 
-		it.valid = true;
+		it.valid = hashes != nullptr;
 		it.pos = 0;
+		it.key = nullptr;
+		it.value = nullptr;
 
 		return next_iter(it);
 	}
@@ -341,21 +387,18 @@ public:
 	OAHashMap &operator=(const OAHashMap &) = delete; // Same for assignment operator.
 
 	OAHashMap(uint32_t p_initial_capacity = 64) {
-		capacity = p_initial_capacity;
-
-		keys = memnew_arr(TKey, p_initial_capacity);
-		values = memnew_arr(TValue, p_initial_capacity);
-		hashes = memnew_arr(uint32_t, p_initial_capacity);
-
-		for (uint32_t i = 0; i < p_initial_capacity; i++) {
-			hashes[i] = EMPTY_HASH;
-		}
+		capacity = MAX(next_power_of_2(p_initial_capacity), 4u);
 	}
 
 	~OAHashMap() {
-		memdelete_arr(keys);
-		memdelete_arr(values);
-		memdelete_arr(hashes);
+		if (!hashes) {
+			return;
+		}
+
+		clear();
+		memfree(keys);
+		memfree(values);
+		memfree(hashes);
 	}
 };
 
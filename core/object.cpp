@@ -1118,6 +1118,11 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 		return ERR_UNAVAILABLE;
 	}
 
+	if (s->slot_map.empty()) {
+		return OK; // User signal without connections, nothing to do.
+	}
+
+	// Only allocates if a one shot connection fires.
 	List<_ObjectSignalDisconnectData> disconnect_data;
 
 	//copy on write will ensure that disconnecting the signal or even deleting the object will not affect the signal calling.
@@ -1129,7 +1134,12 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 
 	OBJ_DEBUG_LOCK
 
-	Vector<const Variant *> bind_mem;
+	// Arguments plus binds are assembled on the stack, sized for the connection with the most binds.
+	int max_binds = 0;
+	for (int i = 0; i < ssize; i++) {
+		max_binds = MAX(max_binds, slot_map.getv(i).conn.binds.size());
+	}
+	const Variant **bind_mem = max_binds ? (const Variant **)alloca(sizeof(Variant *) * (p_argcount + max_binds)) : nullptr;
 
 	Error err = OK;
 
@@ -1147,17 +1157,15 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 
 		if (c.binds.size()) {
 			//handle binds
-			bind_mem.resize(p_argcount + c.binds.size());
-
 			for (int j = 0; j < p_argcount; j++) {
-				bind_mem.write[j] = p_args[j];
+				bind_mem[j] = p_args[j];
 			}
 			for (int j = 0; j < c.binds.size(); j++) {
-				bind_mem.write[p_argcount + j] = &c.binds[j];
+				bind_mem[p_argcount + j] = &c.binds[j];
 			}
 
-			args = (const Variant **)bind_mem.ptr();
-			argc = bind_mem.size();
+			args = bind_mem;
+			argc = p_argcount + c.binds.size();
 		}
 
 		if (c.flags & CONNECT_DEFERRED) {
@@ -1934,8 +1942,8 @@ void postinitialize_handler(Object *p_object) {
 void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 	for (uint32_t i = 0; i < slot_count; i++) {
-		uint32_t slot = object_slots[i].next_free;
-		p_func(object_slots[slot].object);
+		uint32_t slot = _get_slot(i).next_free;
+		p_func(_get_slot(slot).object.load(std::memory_order_relaxed));
 	}
 	spin_lock.unlock();
 }
@@ -1946,7 +1954,7 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_blocks[OBJECTDB_SLOT_BLOCK_MAX] = {};
 uint64_t ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
@@ -1958,29 +1966,31 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 	if (unlikely(slot_count == slot_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_reference = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		ObjectSlot *block = memnew_arr(ObjectSlot, OBJECTDB_SLOT_BLOCK_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_BLOCK_SIZE; i++) {
+			block[i].validator.store(0, std::memory_order_relaxed);
+			block[i].object.store(nullptr, std::memory_order_relaxed);
+			block[i].is_reference = false;
+			block[i].next_free = slot_max + i;
 		}
-		slot_max = new_slot_max;
+		slot_blocks[slot_max >> OBJECTDB_SLOT_BLOCK_BITS].store(block, std::memory_order_release);
+		slot_max += OBJECTDB_SLOT_BLOCK_SIZE;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	uint32_t slot = _get_slot(slot_count).next_free;
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_reference = p_object->is_reference();
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
+
+	object_slot.is_reference = p_object->is_reference();
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(validator_counter, std::memory_order_release); // publish last
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
@@ -2003,17 +2013,19 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &object_slot = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
+		if (object_slot.validator.load(std::memory_order_relaxed) != validator) {
 			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+			ERR_FAIL_COND(object_slot.validator.load(std::memory_order_relaxed) != validator);
 		}
 	}
 
@@ -2021,11 +2033,11 @@ void ObjectDB::remove_instance(Object *p_object) {
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_reference = false;
-	object_slots[slot].object = nullptr;
+	_get_slot(slot_count).next_free = slot;
+	//invalidate first, so checks against it fail
+	object_slot.validator.store(0, std::memory_order_release);
+	object_slot.is_reference = false;
+	object_slot.object.store(nullptr, std::memory_order_release);
 
 	spin_lock.unlock();
 }
@@ -2041,8 +2053,8 @@ void ObjectDB::cleanup() {
 		WARN_PRINT("ObjectDB Instances still exist!");
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			for (uint32_t i = 0; i < slot_count; i++) {
-				uint32_t slot = object_slots[i].next_free;
-				Object *obj = object_slots[slot].object;
+				uint32_t slot = _get_slot(i).next_free;
+				Object *obj = _get_slot(slot).object.load(std::memory_order_relaxed);
 
 				String node_name;
 				if (obj->is_class("Node")) {
@@ -2052,14 +2064,16 @@ void ObjectDB::cleanup() {
 					node_name = " - Resource name: " + String(obj->call("get_name")) + " Path: " + String(obj->call("get_path"));
 				}
 
-				uint64_t id = uint64_t(slot) | (uint64_t(object_slots[slot].validator) << OBJECTDB_VALIDATOR_BITS) | (object_slots[slot].is_reference ? OBJECTDB_REFERENCE_BIT : 0);
+				uint64_t id = uint64_t(slot) | (uint64_t(_get_slot(slot).validator.load(std::memory_order_relaxed)) << OBJECTDB_VALIDATOR_BITS) | (_get_slot(slot).is_reference ? OBJECTDB_REFERENCE_BIT : 0);
 				print_line("Leaked instance: " + String(obj->get_class()) + ":" + itos(id) + node_name);
 			}
 		}
 		spin_lock.unlock();
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < slot_max; i += OBJECTDB_SLOT_BLOCK_SIZE) {
+		memdelete_arr(slot_blocks[i >> OBJECTDB_SLOT_BLOCK_BITS].load(std::memory_order_relaxed));
+		slot_blocks[i >> OBJECTDB_SLOT_BLOCK_BITS].store(nullptr, std::memory_order_relaxed);
 	}
+	slot_max = 0;
 }
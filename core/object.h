@@ -760,20 +760,33 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_BITS 24
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
-
-	struct ObjectSlot { //128 bits per slot
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_reference : 1;
-		Object *object;
+#define OBJECTDB_SLOT_BLOCK_BITS 12
+#define OBJECTDB_SLOT_BLOCK_SIZE (1 << OBJECTDB_SLOT_BLOCK_BITS)
+#define OBJECTDB_SLOT_BLOCK_MASK (OBJECTDB_SLOT_BLOCK_SIZE - 1)
+#define OBJECTDB_SLOT_BLOCK_MAX (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_BLOCK_BITS))
+
+	// Slots are allocated in blocks that never move until cleanup(), so get_instance()
+	// can read them without locking. Adding and removing instances is still serialized
+	// by spin_lock; the validator is written last on add and first on remove, so a reader
+	// that sees the same validator before and after reading the object got a valid pointer.
+	struct ObjectSlot {
+		std::atomic<uint64_t> validator; // 0 means the slot is free
+		std::atomic<Object *> object;
+		uint32_t next_free;
+		bool is_reference;
 	};
 
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
 	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static std::atomic<ObjectSlot *> slot_blocks[OBJECTDB_SLOT_BLOCK_MAX];
 	static uint64_t validator_counter;
 
+	// Only to be used with spin_lock held.
+	_FORCE_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_blocks[p_slot >> OBJECTDB_SLOT_BLOCK_BITS].load(std::memory_order_relaxed)[p_slot & OBJECTDB_SLOT_BLOCK_MASK];
+	}
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -791,20 +804,23 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); //this should never happen unless RID is corrupted
+		ObjectSlot *block = slot_blocks[slot >> OBJECTDB_SLOT_BLOCK_BITS].load(std::memory_order_acquire);
 
-		spin_lock.lock();
+		ERR_FAIL_COND_V(!block, nullptr); //this should never happen unless RID is corrupted
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ObjectSlot &object_slot = block[slot & OBJECTDB_SLOT_BLOCK_MASK];
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed (or even reused) while reading it.
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -62,9 +62,8 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 uint64_t Memory::mem_usage = 0;
 uint64_t Memory::max_usage = 0;
-#endif
-
 uint64_t Memory::alloc_count = 0;
+#endif
 
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
@@ -77,7 +76,9 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	ERR_FAIL_COND_V(!mem, nullptr);
 
+#ifdef DEBUG_ENABLED
 	atomic_increment(&alloc_count);
+#endif
 
 	if (prepad) {
 		uint64_t *s = (uint64_t *)mem;
@@ -156,7 +157,9 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
+#ifdef DEBUG_ENABLED
 	atomic_decrement(&alloc_count);
+#endif
 
 	if (prepad) {
 		mem -= PAD_ALIGN;
@@ -192,6 +195,14 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_alloc_count() {
+#ifdef DEBUG_ENABLED
+	return alloc_count;
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
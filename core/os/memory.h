@@ -45,9 +45,8 @@ class Memory {
 #ifdef DEBUG_ENABLED
 	static uint64_t mem_usage;
 	static uint64_t max_usage;
-#endif
-
 	static uint64_t alloc_count;
+#endif
 
 public:
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
@@ -57,6 +56,7 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+	static uint64_t get_alloc_count();
 };
 
 class DefaultAllocator {
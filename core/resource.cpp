@@ -82,7 +82,7 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 
 	if (path_cache != "") {
 		ResourceCache::lock->write_lock();
-		ResourceCache::resources[path_cache] = this;
+		ResourceCache::resources.set(path_cache, this);
 		ResourceCache::lock->write_unlock();
 	}
 
@@ -412,7 +412,7 @@ Resource::~Resource() {
 	}
 }
 
-HashMap<String, Resource *> ResourceCache::resources;
+OAHashMap<String, Resource *> ResourceCache::resources;
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, int>> ResourceCache::resource_path_cache;
 #endif
@@ -461,23 +461,18 @@ bool ResourceCache::has(const String &p_path) {
 Resource *ResourceCache::get(const String &p_path) {
 	lock->read_lock();
 
-	Resource **res = resources.getptr(p_path);
+	Resource *res = nullptr;
+	resources.lookup(p_path, res);
 
 	lock->read_unlock();
 
-	if (!res) {
-		return nullptr;
-	}
-
-	return *res;
+	return res;
 }
 
 void ResourceCache::get_cached_resources(List<Ref<Resource>> *p_resources) {
 	lock->read_lock();
-	const String *K = nullptr;
-	while ((K = resources.next(K))) {
-		Resource *r = resources[*K];
-		p_resources->push_back(Ref<Resource>(r));
+	for (OAHashMap<String, Resource *>::Iterator it = resources.iter(); it.valid; it = resources.next_iter(it)) {
+		p_resources->push_back(Ref<Resource>(*it.value));
 	}
 	lock->read_unlock();
 }
@@ -502,9 +497,8 @@ void ResourceCache::dump(const char *p_file, bool p_short) {
 		ERR_FAIL_COND_MSG(!f, "Cannot create file at path '" + String(p_file) + "'.");
 	}
 
-	const String *K = nullptr;
-	while ((K = resources.next(K))) {
-		Resource *r = resources[*K];
+	for (OAHashMap<String, Resource *>::Iterator it = resources.iter(); it.valid; it = resources.next_iter(it)) {
+		Resource *r = *it.value;
 
 		if (!type_count.has(r->get_class())) {
 			type_count[r->get_class()] = 0;
@@ -32,6 +32,7 @@
 #define RESOURCE_H
 
 #include "core/class_db.h"
+#include "core/oa_hash_map.h"
 #include "core/object.h"
 #include "core/reference.h"
 #include "core/safe_refcount.h"
@@ -147,7 +148,7 @@ class ResourceCache {
 	friend class Resource;
 	friend class ResourceLoader; //need the lock
 	static RWLock *lock;
-	static HashMap<String, Resource *> resources;
+	static OAHashMap<String, Resource *> resources;
 #ifdef TOOLS_ENABLED
 	static HashMap<String, HashMap<String, int>> resource_path_cache; // each tscn has a set of resource paths and IDs
 	static RWLock *path_cache_lock;
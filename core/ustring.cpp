@@ -1366,6 +1366,14 @@ CharString String::ascii(bool p_allow_extended) const {
 	return cs;
 }
 
+// True if the 8 bytes at p_str are all ASCII and none of them is zero, so a whole
+// word can be copied at once instead of decoding byte by byte.
+static _FORCE_INLINE_ bool _is_ascii_word(const char *p_str) {
+	uint64_t word;
+	memcpy(&word, p_str, sizeof(word));
+	return ((word | (word - 0x0101010101010101ULL)) & 0x8080808080808080ULL) == 0;
+}
+
 String String::utf8(const char *p_utf8, int p_len) {
 	String ret;
 	ret.parse_utf8(p_utf8, p_len);
@@ -1397,11 +1405,22 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 		}
 	}
 
+	if (p_len < 0) {
+		p_len = strlen(p_utf8);
+	}
+
 	{
 		const char *ptrtmp = p_utf8;
 		const char *ptrtmp_limit = &p_utf8[p_len];
 		int skip = 0;
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
+			if (skip == 0 && ptrtmp_limit - ptrtmp >= 8 && _is_ascii_word(ptrtmp)) {
+				str_size += 8;
+				cstr_size += 8;
+				ptrtmp += 8;
+				continue;
+			}
+
 			if (skip == 0) {
 				uint8_t c = *ptrtmp >= 0 ? *ptrtmp : uint8_t(256 + *ptrtmp);
 
@@ -1455,6 +1474,16 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 	dst[str_size] = 0;
 
 	while (cstr_size) {
+		if (cstr_size >= 8 && _is_ascii_word(p_utf8)) {
+			for (int i = 0; i < 8; i++) {
+				dst[i] = p_utf8[i];
+			}
+			dst += 8;
+			p_utf8 += 8;
+			cstr_size -= 8;
+			continue;
+		}
+
 		int len = 0;
 
 		/* Determine the number of characters in sequence */
@@ -1530,11 +1559,15 @@ CharString String::utf8() const {
 
 	const CharType *d = &operator[](0);
 	int fl = 0;
+	bool all_ascii = true;
 	for (int i = 0; i < l; i++) {
 		uint32_t c = d[i];
 		if (c <= 0x7f) { // 7 bits.
 			fl += 1;
-		} else if (c <= 0x7ff) { // 11 bits
+			continue;
+		}
+		all_ascii = false;
+		if (c <= 0x7ff) { // 11 bits
 			fl += 2;
 		} else if (c <= 0xffff) { // 16 bits
 			fl += 3;
@@ -1556,6 +1589,16 @@ CharString String::utf8() const {
 	utf8s.resize(fl + 1);
 	uint8_t *cdst = (uint8_t *)utf8s.get_data();
 
+	if (all_ascii) {
+		// Plain ASCII, nothing to encode.
+		for (int i = 0; i < l; i++) {
+			cdst[i] = d[i];
+		}
+		cdst[l] = 0; //trailing zero
+
+		return utf8s;
+	}
+
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
@@ -2376,28 +2419,28 @@ int String::find(const String &p_str, int p_from) const {
 		return -1; // won't find anything!
 	}
 
+	if (p_from > len - src_len) {
+		return -1;
+	}
+
 	const CharType *src = c_str();
 	const CharType *str = p_str.c_str();
 
-	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
+	// Look for the first character with wmemchr, which the C library vectorizes,
+	// then compare the rest of the key.
+	const CharType *from = src + p_from;
+	const CharType *last = src + (len - src_len);
 
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			};
-
-			if (src[read_pos] != str[j]) {
-				found = false;
-				break;
-			}
+	while (from <= last) {
+		from = wmemchr(from, str[0], last - from + 1);
+		if (!from) {
+			return -1;
 		}
 
-		if (found) {
-			return i;
+		if (memcmp(from + 1, str + 1, (src_len - 1) * sizeof(CharType)) == 0) {
+			return from - src;
 		}
+		from++;
 	}
 
 	return -1;
@@ -2944,21 +2987,47 @@ String String::format(const Variant &values, String placeholder) const {
 }
 
 String String::replace(const String &p_key, const String &p_with) const {
-	String new_string;
-	int search_from = 0;
+	const int key_len = p_key.length();
+	const int with_len = p_with.length();
+
+	// Find all occurrences first, so the result is allocated once.
+	Vector<int> matches;
 	int result = 0;
+	int search_from = 0;
 
 	while ((result = find(p_key, search_from)) >= 0) {
-		new_string += substr(search_from, result - search_from);
-		new_string += p_with;
-		search_from = result + p_key.length();
+		matches.push_back(result);
+		search_from = result + key_len;
 	}
 
-	if (search_from == 0) {
+	if (matches.empty()) {
 		return *this;
 	}
 
-	new_string += substr(search_from, length() - search_from);
+	const int len = length();
+	const int new_len = len + matches.size() * (with_len - key_len);
+	if (new_len == 0) {
+		return String();
+	}
+
+	String new_string;
+	new_string.resize(new_len + 1);
+
+	const CharType *src = c_str();
+	const CharType *with = p_with.c_str();
+	CharType *dst = new_string.ptrw();
+
+	int from = 0;
+	for (int i = 0; i < matches.size(); i++) {
+		int match = matches[i];
+		memcpy(dst, src + from, (match - from) * sizeof(CharType));
+		dst += match - from;
+		memcpy(dst, with, with_len * sizeof(CharType));
+		dst += with_len;
+		from = match + key_len;
+	}
+	memcpy(dst, src + from, (len - from) * sizeof(CharType));
+	dst[len - from] = 0;
 
 	return new_string;
 }
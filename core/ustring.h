@@ -94,10 +94,15 @@ public:
 
 	_FORCE_INLINE_ CharString() {}
 	_FORCE_INLINE_ CharString(const CharString &p_str) { _cowdata._ref(p_str._cowdata); }
-	_FORCE_INLINE_ CharString operator=(const CharString &p_str) {
+	_FORCE_INLINE_ CharString(CharString &&p_str) { _cowdata._move(p_str._cowdata); }
+	_FORCE_INLINE_ CharString &operator=(const CharString &p_str) {
 		_cowdata._ref(p_str._cowdata);
 		return *this;
 	}
+	_FORCE_INLINE_ CharString &operator=(CharString &&p_str) {
+		_cowdata._move(p_str._cowdata);
+		return *this;
+	}
 	_FORCE_INLINE_ CharString(const char *p_cstr) { copy_from(p_cstr); }
 
 	CharString &operator=(const char *p_cstr);
@@ -356,10 +361,15 @@ public:
 
 	_FORCE_INLINE_ String() {}
 	_FORCE_INLINE_ String(const String &p_str) { _cowdata._ref(p_str._cowdata); }
-	String operator=(const String &p_str) {
+	_FORCE_INLINE_ String(String &&p_str) { _cowdata._move(p_str._cowdata); }
+	String &operator=(const String &p_str) {
 		_cowdata._ref(p_str._cowdata);
 		return *this;
 	}
+	String &operator=(String &&p_str) {
+		_cowdata._move(p_str._cowdata);
+		return *this;
+	}
 
 	String(const char *p_str);
 	String(const CharType *p_str, int p_clip_to_len = -1);
@@ -122,6 +122,10 @@ public:
 		_cowdata._ref(p_from._cowdata);
 		return *this;
 	}
+	inline Vector &operator=(Vector &&p_from) {
+		_cowdata._move(p_from._cowdata);
+		return *this;
+	}
 
 	Vector<uint8_t> to_byte_array() const {
 		Vector<uint8_t> ret;
@@ -155,6 +159,7 @@ public:
 
 	_FORCE_INLINE_ Vector() {}
 	_FORCE_INLINE_ Vector(const Vector &p_from) { _cowdata._ref(p_from._cowdata); }
+	_FORCE_INLINE_ Vector(Vector &&p_from) { _cowdata._move(p_from._cowdata); }
 
 	_FORCE_INLINE_ ~Vector() {}
 };
@@ -32,6 +32,7 @@
 
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/input/input.h"
 #include "core/input/input_map.h"
 #include "core/io/file_access_network.h"
@@ -161,6 +162,7 @@ static int frame_delay = 0;
 static bool disable_render_loop = false;
 static int fixed_fps = -1;
 static bool print_fps = false;
+static String trace_file;
 
 /* Helper methods */
 
@@ -333,6 +335,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --disable-crash-handler          Disable crash handler when supported by the platform code.\n");
 	OS::get_singleton()->print("  --fixed-fps <fps>                Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	OS::get_singleton()->print("  --print-fps                      Print the frames per second to the stdout.\n");
+	OS::get_singleton()->print("  --trace <file>                   Record engine zones and save the last frames as a Chrome trace (JSON) to <file> on exit.\n");
 	OS::get_singleton()->print("\n");
 
 	OS::get_singleton()->print("Standalone tools:\n");
@@ -850,6 +853,20 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			}
 		} else if (I->get() == "--print-fps") {
 			print_fps = true;
+		} else if (I->get() == "--trace") {
+			if (I->next()) {
+				trace_file = I->next()->get();
+				if (trace_file.is_rel_path()) {
+					// The working directory may still change, e.g. with --path.
+					DirAccess *da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+					trace_file = da->get_current_dir().plus_file(trace_file);
+					memdelete(da);
+				}
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing trace file argument, aborting.\n");
+				goto error;
+			}
 		} else if (I->get() == "--disable-crash-handler") {
 			OS::get_singleton()->disable_crash_handler();
 		} else if (I->get() == "--skip-breakpoints") {
@@ -861,6 +878,10 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		I = N;
 	}
 
+	if (trace_file != "") {
+		TraceRecorder::start();
+	}
+
 #ifdef TOOLS_ENABLED
 	if (editor && project_manager) {
 		OS::get_singleton()->print("Error: Command line arguments implied opening both editor and project manager, which is not possible. Aborting.\n");
@@ -1484,6 +1505,7 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	locale = String();
 
 	ClassDB::set_current_api(ClassDB::API_NONE); //no more api is registered at this point
+	ClassDB::freeze();
 
 	print_verbose("CORE API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_CORE)));
 	print_verbose("EDITOR API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_EDITOR)));
@@ -2076,6 +2098,8 @@ static uint64_t physics_process_max = 0;
 static uint64_t idle_process_max = 0;
 
 bool Main::iteration() {
+	TRACE_ZONE("Main::iteration");
+
 	//for now do not error on this
 	//ERR_FAIL_COND_V(iterating, false);
 
@@ -2118,6 +2142,8 @@ bool Main::iteration() {
 	Engine::get_singleton()->_in_physics = true;
 
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
+		TRACE_ZONE("Main::physics_frame");
+
 		uint64_t physics_begin = OS::get_singleton()->get_ticks_usec();
 
 		PhysicsServer3D::get_singleton()->sync();
@@ -2151,11 +2177,17 @@ bool Main::iteration() {
 
 	uint64_t idle_begin = OS::get_singleton()->get_ticks_usec();
 
+	// Idle processing issues lots of small rendering commands, hand them to
+	// the render thread all at once instead of waking it up for each.
+	RenderingServer::get_singleton()->begin_command_batch();
+
 	if (OS::get_singleton()->get_main_loop()->idle(step * time_scale)) {
 		exit = true;
 	}
 	message_queue->flush();
 
+	RenderingServer::get_singleton()->end_command_batch();
+
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
 
 	if (DisplayServer::get_singleton()->can_any_window_draw() && !disable_render_loop) {
@@ -2320,6 +2352,12 @@ void Main::cleanup() {
 	finalize_navigation_server();
 	finalize_display();
 
+	// All engine threads are done by now.
+	if (trace_file != "") {
+		TraceRecorder::save(trace_file);
+	}
+	TraceRecorder::finish();
+
 	if (input) {
 		memdelete(input);
 	}
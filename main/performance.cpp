@@ -71,6 +71,15 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_LARGEST_ISLAND);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_PAIRS_TESTED);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_PAIRS_COLLIDING);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_QUERY_COUNT);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_LARGEST_ISLAND);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_PAIRS_TESTED);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_PAIRS_COLLIDING);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_QUERY_COUNT);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -115,6 +124,15 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/output_latency",
+		"physics_2d/largest_island",
+		"physics_2d/pairs_tested",
+		"physics_2d/pairs_colliding",
+		"physics_2d/queries",
+		"physics_3d/largest_island",
+		"physics_3d/pairs_tested",
+		"physics_3d/pairs_colliding",
+		"physics_3d/queries",
+		"memory/allocations",
 
 	};
 
@@ -177,6 +195,24 @@ float Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case PHYSICS_2D_LARGEST_ISLAND:
+			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_LARGEST_ISLAND);
+		case PHYSICS_2D_PAIRS_TESTED:
+			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_PAIRS_TESTED);
+		case PHYSICS_2D_PAIRS_COLLIDING:
+			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_PAIRS_COLLIDING);
+		case PHYSICS_2D_QUERY_COUNT:
+			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_QUERY_COUNT);
+		case PHYSICS_3D_LARGEST_ISLAND:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_LARGEST_ISLAND);
+		case PHYSICS_3D_PAIRS_TESTED:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_PAIRS_TESTED);
+		case PHYSICS_3D_PAIRS_COLLIDING:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_PAIRS_COLLIDING);
+		case PHYSICS_3D_QUERY_COUNT:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_QUERY_COUNT);
+		case MEMORY_ALLOCATIONS:
+			return Memory::get_alloc_count();
 
 		default: {
 		}
@@ -217,6 +253,15 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 
@@ -78,6 +78,15 @@ public:
 		PHYSICS_3D_ISLAND_COUNT,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		PHYSICS_2D_LARGEST_ISLAND,
+		PHYSICS_2D_PAIRS_TESTED,
+		PHYSICS_2D_PAIRS_COLLIDING,
+		PHYSICS_2D_QUERY_COUNT,
+		PHYSICS_3D_LARGEST_ISLAND,
+		PHYSICS_3D_PAIRS_TESTED,
+		PHYSICS_3D_PAIRS_COLLIDING,
+		PHYSICS_3D_QUERY_COUNT,
+		MEMORY_ALLOCATIONS,
 		MONITOR_MAX
 	};
 
@@ -0,0 +1,204 @@
+/*************************************************************************/
+/*  test_animation.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_animation.h"
+
+#include "core/os/os.h"
+#include "scene/resources/animation.h"
+
+namespace TestAnimation {
+
+#define KEY_COUNT 200
+#define KEY_STEP 0.0175
+
+#define CHECK(m_cond)                                                 \
+	{                                                                 \
+		bool success = m_cond;                                        \
+		state = state && success;                                     \
+		if (!success) {                                               \
+			OS::get_singleton()->print("\tfailed at: %s\n", #m_cond); \
+		}                                                             \
+	}
+
+static Ref<Animation> _make_animation() {
+	Ref<Animation> anim;
+	anim.instance();
+	anim->set_length(KEY_COUNT * KEY_STEP);
+	int track = anim->add_track(Animation::TYPE_TRANSFORM);
+	anim->track_set_path(track, NodePath("Skeleton:bone"));
+	for (int i = 0; i < KEY_COUNT; i++) {
+		Vector3 loc(Math::sin(i * 0.1) * 3.0, i * 0.01, -2.0);
+		Quat rot(Vector3(0, 1, 0), i * 0.05);
+		Vector3 scale(1.0, 1.0 + i * 0.001, 1.0);
+		anim->transform_track_insert_key(track, i * KEY_STEP, loc, rot, scale);
+	}
+	return anim;
+}
+
+static Ref<Animation> _make_compressed_animation() {
+	Ref<Animation> anim = _make_animation();
+	anim->compress();
+	return anim;
+}
+
+static Ref<Animation> _load_compressed_keys(const Dictionary &p_keys) {
+	Ref<Animation> anim;
+	anim.instance();
+	anim->set("tracks/0/type", "transform");
+	anim->set("tracks/0/compressed_keys", p_keys);
+	return anim;
+}
+
+// Compares two animations at every key and halfway between keys.
+static bool _same_motion(const Ref<Animation> &p_a, const Ref<Animation> &p_b, float p_tolerance) {
+	for (int i = 0; i < KEY_COUNT * 2; i++) {
+		float time = i * KEY_STEP * 0.5;
+		Vector3 loc_a, loc_b, scale_a, scale_b;
+		Quat rot_a, rot_b;
+		p_a->transform_track_interpolate(0, time, &loc_a, &rot_a, &scale_a);
+		p_b->transform_track_interpolate(0, time, &loc_b, &rot_b, &scale_b);
+		if (loc_a.distance_to(loc_b) > p_tolerance || scale_a.distance_to(scale_b) > p_tolerance || Math::abs(rot_a.dot(rot_b)) < 1.0 - p_tolerance) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool test_1() {
+	OS::get_singleton()->print("\n\nTest 1: Compress a track with %d keys\n", KEY_COUNT);
+	bool state = true;
+
+	Ref<Animation> source = _make_animation();
+	Ref<Animation> compressed = _make_compressed_animation();
+	CHECK(compressed->track_is_compressed(0));
+	CHECK(compressed->track_get_key_count(0) == KEY_COUNT);
+	CHECK(_same_motion(source, compressed, 0.001));
+
+	return state;
+}
+
+bool test_2() {
+	OS::get_singleton()->print("\n\nTest 2: Save and load compressed keys\n");
+	bool state = true;
+
+	Ref<Animation> compressed = _make_compressed_animation();
+	Ref<Animation> loaded = _load_compressed_keys(compressed->get("tracks/0/compressed_keys"));
+	CHECK(loaded->track_is_compressed(0));
+	CHECK(_same_motion(compressed, loaded, CMP_EPSILON));
+
+	return state;
+}
+
+bool test_3() {
+	OS::get_singleton()->print("\n\nTest 3: Reject damaged compressed keys\n");
+	bool state = true;
+
+	Ref<Animation> compressed = _make_compressed_animation();
+	Dictionary saved = compressed->get("tracks/0/compressed_keys");
+
+	Dictionary damaged = saved.duplicate();
+	Vector<int> pages = saved["pages"];
+	pages.write[1] = KEY_COUNT + 1;
+	damaged["pages"] = pages;
+	CHECK(!_load_compressed_keys(damaged)->track_is_compressed(0));
+
+	damaged = saved.duplicate();
+	damaged["page_length"] = 0.0;
+	CHECK(!_load_compressed_keys(damaged)->track_is_compressed(0));
+
+	return state;
+}
+
+bool test_4() {
+	OS::get_singleton()->print("\n\nTest 4: Decompress a track when editing a key\n");
+	bool state = true;
+
+	Ref<Animation> source = _make_animation();
+	Ref<Animation> compressed = _make_compressed_animation();
+	compressed->track_set_key_transition(0, 0, 1.0);
+	CHECK(!compressed->track_is_compressed(0));
+	CHECK(compressed->track_get_key_count(0) == KEY_COUNT);
+	CHECK(_same_motion(source, compressed, 0.001));
+
+	return state;
+}
+
+bool test_5() {
+	OS::get_singleton()->print("\n\nTest 5: Remove a compressed track\n");
+	bool state = true;
+
+	Ref<Animation> compressed = _make_compressed_animation();
+	compressed->remove_track(0);
+	CHECK(compressed->get_track_count() == 0);
+
+	return state;
+}
+
+typedef bool (*TestFunc)();
+
+TestFunc test_funcs[] = {
+
+	test_1,
+	test_2,
+	test_3,
+	test_4,
+	test_5,
+	nullptr
+
+};
+
+MainLoop *test() {
+	int count = 0;
+	int passed = 0;
+
+	while (true) {
+		if (!test_funcs[count]) {
+			break;
+		}
+		bool pass = test_funcs[count]();
+		if (pass) {
+			passed++;
+		}
+		OS::get_singleton()->print("\t%s\n", pass ? "PASS" : "FAILED");
+
+		count++;
+	}
+
+	OS::get_singleton()->print("\n\n\n");
+	OS::get_singleton()->print("*************\n");
+	OS::get_singleton()->print("***TOTALS!***\n");
+	OS::get_singleton()->print("*************\n");
+
+	OS::get_singleton()->print("Passed %i of %i tests\n", passed, count);
+
+	return nullptr;
+}
+
+} // namespace TestAnimation
@@ -0,0 +1,230 @@
+/*************************************************************************/
+/*  test_dictionary.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_dictionary.h"
+
+#include "core/dictionary.h"
+#include "core/os/os.h"
+#include "core/variant.h"
+
+namespace TestDictionary {
+
+#define ENTRY_COUNT 1000
+
+#define CHECK(m_cond)                                                 \
+	{                                                                 \
+		bool success = m_cond;                                        \
+		state = state && success;                                     \
+		if (!success) {                                               \
+			OS::get_singleton()->print("\tfailed at: %s\n", #m_cond); \
+		}                                                             \
+	}
+
+static Dictionary _make_dictionary() {
+	Dictionary dict;
+	for (int i = 0; i < ENTRY_COUNT; i++) {
+		dict[i] = itos(i);
+	}
+	return dict;
+}
+
+// Keeps only the odd keys, erasing a few entries first to leave holes and then most of them to compact the entries.
+static Dictionary _make_odd_dictionary() {
+	Dictionary dict = _make_dictionary();
+	for (int i = 0; i < ENTRY_COUNT; i += 2) {
+		dict.erase(i);
+	}
+	return dict;
+}
+
+// Checks that the dictionary holds exactly the odd keys below ENTRY_COUNT, in order, through every accessor.
+static bool _check_odd_keys(const Dictionary &p_dict) {
+	bool state = true;
+
+	CHECK(p_dict.size() == ENTRY_COUNT / 2);
+
+	Array keys = p_dict.keys();
+	Array values = p_dict.values();
+	int key_errors = 0;
+	for (int i = 0; i < keys.size(); i++) {
+		int key = i * 2 + 1;
+		if (int(keys[i]) != key || String(values[i]) != itos(key) || p_dict.get_key_at_index(i) != Variant(key) || p_dict.get_value_at_index(i) != Variant(itos(key))) {
+			key_errors++;
+		}
+	}
+	CHECK(keys.size() == ENTRY_COUNT / 2 && key_errors == 0);
+
+	int lookup_errors = 0;
+	for (int i = 0; i < ENTRY_COUNT; i++) {
+		const Variant *value = p_dict.getptr(i);
+		if ((i % 2 == 1) != (value != nullptr) || (value && String(*value) != itos(i))) {
+			lookup_errors++;
+		}
+	}
+	CHECK(lookup_errors == 0);
+
+	int iterated = 0;
+	int expected = 1;
+	for (const Variant *key = p_dict.next(); key; key = p_dict.next(key)) {
+		if (int(*key) != expected) {
+			break;
+		}
+		expected += 2;
+		iterated++;
+	}
+	CHECK(iterated == ENTRY_COUNT / 2);
+
+	return state;
+}
+
+bool test_1() {
+	OS::get_singleton()->print("\n\nTest 1: Insert %d entries\n", ENTRY_COUNT);
+	bool state = true;
+
+	Dictionary dict = _make_dictionary();
+	CHECK(dict.size() == ENTRY_COUNT);
+	CHECK(int(dict.get_key_at_index(ENTRY_COUNT - 1)) == ENTRY_COUNT - 1);
+
+	return state;
+}
+
+bool test_2() {
+	OS::get_singleton()->print("\n\nTest 2: Erase entries\n");
+	bool state = true;
+
+	Dictionary dict = _make_dictionary();
+	for (int i = 0; i < 8; i += 2) {
+		CHECK(dict.erase(i));
+	}
+	CHECK(!dict.erase(0));
+	CHECK(int(dict.get_key_at_index(0)) == 1 && int(dict.get_key_at_index(4)) == 8);
+	for (int i = 8; i < ENTRY_COUNT; i += 2) {
+		dict.erase(i);
+	}
+	CHECK(_check_odd_keys(dict));
+
+	return state;
+}
+
+bool test_3() {
+	OS::get_singleton()->print("\n\nTest 3: Add an erased key again\n");
+	bool state = true;
+
+	// Keys added again go to the end, like new ones.
+	Dictionary dict = _make_odd_dictionary();
+	dict[0] = "0";
+	CHECK(int(dict.get_key_at_index(dict.size() - 1)) == 0);
+	dict.erase(0);
+	CHECK(_check_odd_keys(dict));
+
+	return state;
+}
+
+bool test_4() {
+	OS::get_singleton()->print("\n\nTest 4: Duplicate\n");
+	bool state = true;
+
+	Dictionary dict = _make_odd_dictionary();
+	Dictionary copy = dict.duplicate();
+	CHECK(copy.hash() == dict.hash());
+	copy.erase(1);
+	CHECK(dict.has(1) && !copy.has(1));
+
+	return state;
+}
+
+bool test_5() {
+	OS::get_singleton()->print("\n\nTest 5: Keys of different types\n");
+	bool state = true;
+
+	// Keys of different types must not collide.
+	Dictionary mixed;
+	mixed[1] = "int";
+	mixed["1"] = "string";
+	mixed[StringName("name")] = "string_name";
+	CHECK(mixed.size() == 3);
+	CHECK(String(mixed[1]) == "int" && String(mixed["1"]) == "string");
+
+	return state;
+}
+
+bool test_6() {
+	OS::get_singleton()->print("\n\nTest 6: Clear\n");
+	bool state = true;
+
+	Dictionary dict = _make_odd_dictionary();
+	dict.clear();
+	CHECK(dict.empty() && dict.next() == nullptr);
+
+	return state;
+}
+
+typedef bool (*TestFunc)();
+
+TestFunc test_funcs[] = {
+
+	test_1,
+	test_2,
+	test_3,
+	test_4,
+	test_5,
+	test_6,
+	nullptr
+
+};
+
+MainLoop *test() {
+	int count = 0;
+	int passed = 0;
+
+	while (true) {
+		if (!test_funcs[count]) {
+			break;
+		}
+		bool pass = test_funcs[count]();
+		if (pass) {
+			passed++;
+		}
+		OS::get_singleton()->print("\t%s\n", pass ? "PASS" : "FAILED");
+
+		count++;
+	}
+
+	OS::get_singleton()->print("\n\n\n");
+	OS::get_singleton()->print("*************\n");
+	OS::get_singleton()->print("***TOTALS!***\n");
+	OS::get_singleton()->print("*************\n");
+
+	OS::get_singleton()->print("Passed %i of %i tests\n", passed, count);
+
+	return nullptr;
+}
+
+} // namespace TestDictionary
@@ -34,10 +34,14 @@
 
 #ifdef DEBUG_ENABLED
 
+#include "test_animation.h"
 #include "test_astar.h"
+#include "test_dictionary.h"
 #include "test_gdscript.h"
 #include "test_gui.h"
 #include "test_math.h"
+#include "test_node.h"
+#include "test_object_db.h"
 #include "test_oa_hash_map.h"
 #include "test_ordered_hash_map.h"
 #include "test_physics_2d.h"
@@ -62,6 +66,10 @@ const char **tests_get_names() {
 		"gd_bytecode",
 		"ordered_hash_map",
 		"astar",
+		"object_db",
+		"node",
+		"animation",
+		"dictionary",
 		nullptr
 	};
 
@@ -127,6 +135,22 @@ MainLoop *test_main(String p_test, const List<String> &p_args) {
 		return TestAStar::test();
 	}
 
+	if (p_test == "object_db") {
+		return TestObjectDB::test();
+	}
+
+	if (p_test == "node") {
+		return TestNode::test();
+	}
+
+	if (p_test == "animation") {
+		return TestAnimation::test();
+	}
+
+	if (p_test == "dictionary") {
+		return TestDictionary::test();
+	}
+
 	print_line("Unknown test: " + p_test);
 	return nullptr;
 }
@@ -0,0 +1,298 @@
+/*************************************************************************/
+/*  test_node.cpp                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_node.h"
+
+#include "core/os/os.h"
+#include "core/set.h"
+#include "scene/main/node.h"
+
+namespace TestNode {
+
+#define NODE_COUNT 10000
+#define CHUNK_SIZE 100
+
+static uint64_t _ticks() {
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+#define CHECK(m_cond)                                                 \
+	{                                                                 \
+		bool success = m_cond;                                        \
+		state = state && success;                                     \
+		if (!success) {                                               \
+			OS::get_singleton()->print("\tfailed at: %s\n", #m_cond); \
+		}                                                             \
+	}
+
+bool test_1() {
+	OS::get_singleton()->print("\n\nTest 1: Add %d named children\n", NODE_COUNT);
+	bool state = true;
+
+	Node *parent = memnew(Node);
+
+	uint64_t from = _ticks();
+	for (int i = 0; i < NODE_COUNT; i++) {
+		Node *n = memnew(Node);
+		n->set_name("Node" + itos(i));
+		parent->add_child(n);
+	}
+	uint64_t add_time = _ticks() - from;
+
+	from = _ticks();
+	int found = 0;
+	for (int i = 0; i < NODE_COUNT; i++) {
+		if (parent->has_node(NodePath("Node" + itos(i)))) {
+			found++;
+		}
+	}
+	uint64_t lookup_time = _ticks() - from;
+
+	CHECK(found == NODE_COUNT);
+
+	// Renaming must keep lookups consistent.
+	Node *child = parent->get_child(NODE_COUNT / 2);
+	child->set_name("Renamed");
+	CHECK(parent->get_node_or_null(NodePath("Renamed")) == child);
+	CHECK(parent->get_node_or_null(NodePath("Node" + itos(NODE_COUNT / 2))) == nullptr);
+
+	from = _ticks();
+	memdelete(parent);
+	uint64_t free_time = _ticks() - from;
+
+	OS::get_singleton()->print("named: add %d usec, lookup %d usec, free %d usec\n", (int)add_time, (int)lookup_time, (int)free_time);
+
+	return state;
+}
+
+static bool _test_add_colliding(bool p_legible) {
+	bool state = true;
+
+	Node *parent = memnew(Node);
+
+	uint64_t from = _ticks();
+	for (int i = 0; i < NODE_COUNT; i++) {
+		Node *n = memnew(Node);
+		n->set_name("Enemy");
+		parent->add_child(n, p_legible);
+	}
+	uint64_t add_time = _ticks() - from;
+
+	Set<StringName> names;
+	for (int i = 0; i < parent->get_child_count(); i++) {
+		names.insert(parent->get_child(i)->get_name());
+	}
+	CHECK(names.size() == NODE_COUNT);
+
+	if (p_legible) {
+		// A removed name is handed out again.
+		Node *removed = parent->get_child(1);
+		StringName removed_name = removed->get_name();
+		parent->remove_child(removed);
+		memdelete(removed);
+
+		Node *n = memnew(Node);
+		n->set_name("Enemy");
+		parent->add_child(n, true);
+		CHECK(n->get_name() == removed_name);
+	}
+
+	memdelete(parent);
+
+	OS::get_singleton()->print("colliding (%s): add %d usec\n", p_legible ? "legible" : "unique", (int)add_time);
+
+	return state;
+}
+
+bool test_2() {
+	OS::get_singleton()->print("\n\nTest 2: Add %d children with the same name\n", NODE_COUNT);
+	return _test_add_colliding(false);
+}
+
+bool test_3() {
+	OS::get_singleton()->print("\n\nTest 3: Add %d children with the same legible name\n", NODE_COUNT);
+	return _test_add_colliding(true);
+}
+
+bool test_4() {
+	OS::get_singleton()->print("\n\nTest 4: Add %d chunks of %d children\n", NODE_COUNT / CHUNK_SIZE, CHUNK_SIZE);
+	bool state = true;
+
+	Vector<Node *> chunks;
+	for (int i = 0; i < NODE_COUNT / CHUNK_SIZE; i++) {
+		Node *chunk = memnew(Node);
+		chunk->set_name("Chunk" + itos(i));
+		for (int j = 0; j < CHUNK_SIZE; j++) {
+			Node *n = memnew(Node);
+			n->set_name("Piece" + itos(j));
+			n->add_to_group("pieces");
+			chunk->add_child(n);
+		}
+		chunks.push_back(chunk);
+	}
+
+	Node *parent = memnew(Node);
+
+	uint64_t from = _ticks();
+	for (int i = 0; i < chunks.size(); i++) {
+		parent->add_child(chunks[i]);
+	}
+	uint64_t add_time = _ticks() - from;
+
+	NodePath path("Chunk7/Piece42");
+	Node *piece = parent->get_node_or_null(path);
+	CHECK(piece != nullptr);
+
+	from = _ticks();
+	int found = 0;
+	for (int i = 0; i < NODE_COUNT; i++) {
+		if (parent->get_node_or_null(path) == piece) {
+			found++;
+		}
+	}
+	uint64_t lookup_time = _ticks() - from;
+	CHECK(found == NODE_COUNT);
+
+	// Cached paths must follow renames.
+	piece->set_name("Moved");
+	CHECK(parent->get_node_or_null(path) == nullptr);
+	CHECK(parent->get_node_or_null(NodePath("Chunk7/Moved")) == piece);
+
+	from = _ticks();
+	while (parent->get_child_count()) {
+		Node *chunk = parent->get_child(parent->get_child_count() - 1);
+		parent->remove_child(chunk);
+		memdelete(chunk);
+	}
+	uint64_t remove_time = _ticks() - from;
+
+	memdelete(parent);
+
+	OS::get_singleton()->print("chunks: add %d usec, path lookup %d usec, remove %d usec\n", (int)add_time, (int)lookup_time, (int)remove_time);
+
+	return state;
+}
+
+bool test_5() {
+	OS::get_singleton()->print("\n\nTest 5: Look up a path while %d nodes churn\n", NODE_COUNT);
+	bool state = true;
+
+	// Path lookups from a stable part of the tree while other nodes keep being
+	// added and removed elsewhere, as happens with spawned projectiles or effects.
+	Node *parent = memnew(Node);
+	Node *level = memnew(Node);
+	level->set_name("Level");
+	parent->add_child(level);
+	Node *player = memnew(Node);
+	player->set_name("Player");
+	level->add_child(player);
+	Node *weapon = memnew(Node);
+	weapon->set_name("Weapon");
+	player->add_child(weapon);
+	Node *spawned = memnew(Node);
+	spawned->set_name("Spawned");
+	parent->add_child(spawned);
+
+	NodePath path("Level/Player/Weapon");
+	int found = 0;
+
+	uint64_t from = _ticks();
+	for (int i = 0; i < NODE_COUNT; i++) {
+		Node *n = memnew(Node);
+		spawned->add_child(n);
+		if (parent->get_node_or_null(path) == weapon) {
+			found++;
+		}
+		if (i % 4 == 3) {
+			Node *old = spawned->get_child(0);
+			spawned->remove_child(old);
+			memdelete(old);
+		}
+	}
+	uint64_t churn_time = _ticks() - from;
+	CHECK(found == NODE_COUNT);
+
+	// Replacing the node at a cached path must be noticed.
+	player->remove_child(weapon);
+	Node *replacement = memnew(Node);
+	replacement->set_name("Weapon");
+	player->add_child(replacement);
+	CHECK(parent->get_node_or_null(path) == replacement);
+	memdelete(weapon);
+	CHECK(parent->get_node_or_null(path) == replacement);
+
+	memdelete(parent);
+
+	OS::get_singleton()->print("path churn: %d usec\n", (int)churn_time);
+
+	return state;
+}
+
+typedef bool (*TestFunc)();
+
+TestFunc test_funcs[] = {
+
+	test_1,
+	test_2,
+	test_3,
+	test_4,
+	test_5,
+	nullptr
+
+};
+
+MainLoop *test() {
+	int count = 0;
+	int passed = 0;
+
+	while (true) {
+		if (!test_funcs[count]) {
+			break;
+		}
+		bool pass = test_funcs[count]();
+		if (pass) {
+			passed++;
+		}
+		OS::get_singleton()->print("\t%s\n", pass ? "PASS" : "FAILED");
+
+		count++;
+	}
+
+	OS::get_singleton()->print("\n\n\n");
+	OS::get_singleton()->print("*************\n");
+	OS::get_singleton()->print("***TOTALS!***\n");
+	OS::get_singleton()->print("*************\n");
+
+	OS::get_singleton()->print("Passed %i of %i tests\n", passed, count);
+
+	return nullptr;
+}
+
+} // namespace TestNode
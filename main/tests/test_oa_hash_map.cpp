@@ -30,11 +30,73 @@
 
 #include "test_oa_hash_map.h"
 
+#include "core/hash_map.h"
 #include "core/oa_hash_map.h"
 #include "core/os/os.h"
 
 namespace TestOAHashMap {
 
+#define BENCHMARK_ELEMENTS 100000
+
+template <class K>
+static void _benchmark(const char *p_name, const Vector<K> &p_keys) {
+	const K *keys = p_keys.ptr();
+	const int count = p_keys.size();
+	uint64_t sum = 0;
+
+	OS::get_singleton()->print("benchmark %s (%d elements)\n", p_name, count);
+
+	{
+		HashMap<K, int> map;
+
+		uint64_t from = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.set(keys[i], i);
+		}
+		uint64_t insert = OS::get_singleton()->get_ticks_usec() - from;
+
+		from = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			sum += *map.getptr(keys[i]);
+		}
+		uint64_t lookup = OS::get_singleton()->get_ticks_usec() - from;
+
+		from = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.erase(keys[i]);
+		}
+		uint64_t erase = OS::get_singleton()->get_ticks_usec() - from;
+
+		OS::get_singleton()->print("\tHashMap:   insert %d usec, lookup %d usec, erase %d usec\n", (int)insert, (int)lookup, (int)erase);
+	}
+
+	{
+		OAHashMap<K, int> map;
+
+		uint64_t from = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.set(keys[i], i);
+		}
+		uint64_t insert = OS::get_singleton()->get_ticks_usec() - from;
+
+		from = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			sum += *map.getptr(keys[i]);
+		}
+		uint64_t lookup = OS::get_singleton()->get_ticks_usec() - from;
+
+		from = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.erase(keys[i]);
+		}
+		uint64_t erase = OS::get_singleton()->get_ticks_usec() - from;
+
+		OS::get_singleton()->print("\tOAHashMap: insert %d usec, lookup %d usec, erase %d usec\n", (int)insert, (int)lookup, (int)erase);
+	}
+
+	OS::get_singleton()->print("\t(checksum %d)\n", (int)(sum & 0x7FFFFFFF));
+}
+
 MainLoop *test() {
 	OS::get_singleton()->print("\n\n\nHello from test\n");
 
@@ -152,6 +214,55 @@ MainLoop *test() {
 		map.set(5, 1);
 	}
 
+	// values must survive rehashing and removal, keys and values are only constructed when used
+	{
+		OAHashMap<String, String> map(4);
+		for (int i = 0; i < 100; i++) {
+			map.set(itos(i), itos(i * 2));
+		}
+		for (int i = 0; i < 100; i += 3) {
+			map.erase(itos(i));
+		}
+
+		int errors = 0;
+		for (int i = 0; i < 100; i++) {
+			String *value = map.getptr(itos(i));
+			if ((i % 3 == 0) != (value == nullptr) || (value && *value != itos(i * 2))) {
+				errors++;
+			}
+		}
+		OS::get_singleton()->print("string map errors: %d, elements: %d\n", errors, map.size());
+	}
+
+	// empty maps allocate nothing, reserving less than the rounded capacity does nothing
+	{
+		OAHashMap<int, int> map;
+		int tmp;
+		bool ok = !map.lookup(1, tmp) && !map.iter().valid && !map.erase(1);
+		map.reserve(100);
+		ok = ok && map.get_capacity() == 128;
+		map.reserve(100);
+		map.reserve(20);
+		ok = ok && map.get_capacity() == 128;
+		map.insert(1, 1);
+		ok = ok && map.lookup(1, tmp) && tmp == 1 && map.get_capacity() == 128;
+		OS::get_singleton()->print("lazy allocation and reserve: %s\n", ok ? "passed" : "failed");
+	}
+
+	// benchmarks against the chained HashMap
+	{
+		Vector<int> int_keys;
+		Vector<String> string_keys;
+		Math::seed(0);
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			int_keys.push_back(Math::rand());
+			string_keys.push_back("res://path/to/resource_" + itos(i) + ".tres");
+		}
+
+		_benchmark("int keys", int_keys);
+		_benchmark("String keys", string_keys);
+	}
+
 	return nullptr;
 }
 
@@ -0,0 +1,143 @@
+/*************************************************************************/
+/*  test_object_db.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_object_db.h"
+
+#include "core/object.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+
+namespace TestObjectDB {
+
+#define OBJECT_COUNT 4096
+#define LOOKUP_COUNT 1000000
+#define THREAD_COUNT 4
+
+struct LookupData {
+	const ObjectID *ids = nullptr;
+	int count = 0;
+	uint32_t found = 0;
+	uint64_t usec = 0;
+};
+
+static std::atomic<bool> churn_exit;
+
+static void _lookup_thread(void *p_userdata) {
+	LookupData *ld = (LookupData *)p_userdata;
+	uint64_t from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < LOOKUP_COUNT; i++) {
+		if (ObjectDB::get_instance(ld->ids[i % ld->count])) {
+			ld->found++;
+		}
+	}
+	ld->usec = OS::get_singleton()->get_ticks_usec() - from;
+}
+
+static void _churn_thread(void *p_userdata) {
+	// Keeps adding and removing instances, so lookups race against slot reuse.
+	while (!churn_exit.load()) {
+		Object *obj = memnew(Object);
+		memdelete(obj);
+	}
+}
+
+static void _run(const ObjectID *p_ids, int p_count, int p_threads, bool p_churn) {
+	LookupData data[THREAD_COUNT];
+	Thread *threads[THREAD_COUNT];
+	Thread *churn = nullptr;
+
+	if (p_churn) {
+		churn_exit.store(false);
+		churn = Thread::create(_churn_thread, nullptr);
+	}
+
+	uint64_t from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_threads; i++) {
+		data[i].ids = p_ids;
+		data[i].count = p_count;
+		threads[i] = Thread::create(_lookup_thread, &data[i]);
+	}
+
+	uint32_t found = 0;
+	for (int i = 0; i < p_threads; i++) {
+		Thread::wait_to_finish(threads[i]);
+		memdelete(threads[i]);
+		found += data[i].found;
+	}
+	uint64_t total = OS::get_singleton()->get_ticks_usec() - from;
+
+	if (churn) {
+		churn_exit.store(true);
+		Thread::wait_to_finish(churn);
+		memdelete(churn);
+	}
+
+	OS::get_singleton()->print("%d thread(s)%s: %d lookups in %d usec (%d found)\n", p_threads, p_churn ? " + churn" : "", p_threads * LOOKUP_COUNT, (int)total, found);
+}
+
+MainLoop *test() {
+	OS::get_singleton()->print("\n\nTesting ObjectDB lookups.\n");
+
+	Vector<Object *> objects;
+	Vector<ObjectID> ids;
+	for (int i = 0; i < OBJECT_COUNT; i++) {
+		Object *obj = memnew(Object);
+		objects.push_back(obj);
+		ids.push_back(obj->get_instance_id());
+	}
+
+	// Sanity check, freed instances must not resolve, even after their slot is reused.
+	{
+		Object *obj = memnew(Object);
+		ObjectID id = obj->get_instance_id();
+		memdelete(obj);
+		Object *reused = memnew(Object);
+		if (ObjectDB::get_instance(id) != nullptr) {
+			OS::get_singleton()->print("FAIL: freed instance still resolves.\n");
+		}
+		if (ObjectDB::get_instance(reused->get_instance_id()) != reused) {
+			OS::get_singleton()->print("FAIL: reused slot does not resolve.\n");
+		}
+		memdelete(reused);
+	}
+
+	for (int i = 1; i <= THREAD_COUNT; i *= 2) {
+		_run(ids.ptr(), ids.size(), i, false);
+	}
+	_run(ids.ptr(), ids.size(), THREAD_COUNT, true);
+
+	for (int i = 0; i < objects.size(); i++) {
+		memdelete(objects[i]);
+	}
+
+	return nullptr;
+}
+
+} // namespace TestObjectDB
@@ -1127,6 +1127,108 @@ bool test_35() {
 	return state;
 }
 
+bool test_36() {
+	OS::get_singleton()->print("\n\nTest 36: UTF-8 conversion, find and replace on long strings\n");
+	bool state = true;
+
+	// Mix ASCII runs of every length with multi-byte characters, so word-at-a-time
+	// fast paths start and stop at every possible offset.
+	String s;
+	for (int i = 0; i < 40; i++) {
+		for (int j = 0; j < i; j++) {
+			s += String::chr('a' + (j % 26));
+		}
+		s += String::utf8("é€");
+	}
+
+	CharString utf8 = s.utf8();
+	String back = String::utf8(utf8.get_data());
+	state = state && back == s;
+	String back_len = String::utf8(utf8.get_data(), utf8.length());
+	state = state && back_len == s;
+
+	// Code points above 31 bits are dropped by the encoder, they must not make
+	// a string with multi-byte characters pass for plain ASCII.
+	if (sizeof(CharType) == 4) {
+		String invalid = String::chr(CharType(0x80000000)) + String::utf8("é");
+		CharString invalid_utf8 = invalid.utf8();
+		state = state && invalid_utf8.length() == 2 && String::utf8(invalid_utf8.get_data()) == String::utf8("é");
+	}
+
+	String ascii = "The quick brown fox jumps over the lazy dog, the quick brown fox.";
+	state = state && String::utf8(ascii.utf8().get_data()) == ascii;
+	state = state && ascii.utf8().length() == ascii.length();
+
+	state = state && ascii.find("quick") == 4;
+	state = state && ascii.find("quick", 5) == 49;
+	state = state && ascii.find("fox.") == 61;
+	state = state && ascii.find("fox..") == -1;
+	state = state && ascii.find(String("x"), 64) == -1;
+	state = state && ascii.find(String("."), 64) == 64;
+
+	state = state && ascii.replace("quick", "slow") == "The slow brown fox jumps over the lazy dog, the slow brown fox.";
+	state = state && ascii.replace("o", "") == "The quick brwn fx jumps ver the lazy dg, the quick brwn fx.";
+	state = state && String("aaa").replace("a", "bb") == "bbbbbb";
+	state = state && String("aaa").replace("a", "") == "";
+	state = state && ascii.replace("cat", "dog") == ascii;
+
+	Vector<String> parts = ascii.split(" ");
+	state = state && parts.size() == 13 && parts[12] == "fox.";
+
+	return state;
+}
+
+bool test_37() {
+	OS::get_singleton()->print("\n\nTest 37: Benchmark UTF-8 conversion and search\n");
+
+	String ascii;
+	String mixed;
+	for (int i = 0; i < 20000; i++) {
+		ascii += "lorem ipsum dolor sit amet ";
+		mixed += String::utf8("lorem ipsum dólor sít ämet ");
+	}
+	CharString ascii_utf8 = ascii.utf8();
+	CharString mixed_utf8 = mixed.utf8();
+
+	uint64_t from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		String::utf8(ascii_utf8.get_data(), ascii_utf8.length());
+	}
+	OS::get_singleton()->print("\tparse_utf8 (ASCII): %d usec\n", (int)(OS::get_singleton()->get_ticks_usec() - from));
+
+	from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		String::utf8(mixed_utf8.get_data(), mixed_utf8.length());
+	}
+	OS::get_singleton()->print("\tparse_utf8 (mixed): %d usec\n", (int)(OS::get_singleton()->get_ticks_usec() - from));
+
+	from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		ascii.utf8();
+	}
+	OS::get_singleton()->print("\tutf8 (ASCII): %d usec\n", (int)(OS::get_singleton()->get_ticks_usec() - from));
+
+	from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		ascii.find("consectetur");
+	}
+	OS::get_singleton()->print("\tfind (no match): %d usec\n", (int)(OS::get_singleton()->get_ticks_usec() - from));
+
+	from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		ascii.replace(String("dolor"), String("pain"));
+	}
+	OS::get_singleton()->print("\treplace: %d usec\n", (int)(OS::get_singleton()->get_ticks_usec() - from));
+
+	from = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		ascii.split(" ");
+	}
+	OS::get_singleton()->print("\tsplit: %d usec\n", (int)(OS::get_singleton()->get_ticks_usec() - from));
+
+	return true;
+}
+
 typedef bool (*TestFunc)();
 
 TestFunc test_funcs[] = {
@@ -1166,6 +1268,8 @@ TestFunc test_funcs[] = {
 	test_33,
 	test_34,
 	test_35,
+	test_36,
+	test_37,
 	nullptr
 
 };
@@ -80,7 +80,7 @@ void Node3D::_notify_dirty() {
 	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
 
 #endif
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 }
 
@@ -95,10 +95,20 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	/*
-	if (data.dirty&DIRTY_GLOBAL)
-		return; //already dirty
-	*/
+	SceneTree *tree = get_tree();
+
+#ifdef TOOLS_ENABLED
+	bool notify = (data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification;
+#else
+	bool notify = data.notify_transform && !data.ignore_notification;
+#endif
+
+	// Nothing read the global transform since the last change was propagated here
+	// (that would have cleared the dirty flag), so the whole subtree is still dirty
+	// and queued. Avoids walking it again when a node is moved several times per frame.
+	if ((data.dirty & DIRTY_GLOBAL) && data.propagated_pass == tree->xform_pass && (!notify || xform_change.in_list())) {
+		return;
+	}
 
 	data.children_lock++;
 
@@ -108,18 +118,25 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		}
 		E->get()->_propagate_transform_changed(p_origin);
 	}
-#ifdef TOOLS_ENABLED
-	if ((data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
-#else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-#endif
-		get_tree()->xform_change_list.add(&xform_change);
+	if (notify && !xform_change.in_list()) {
+		tree->_add_xform_change(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL;
+	data.propagated_pass = tree->xform_pass;
 
 	data.children_lock--;
 }
 
+void Node3D::_invalidate_transform_propagation() {
+	// This node may now need a notification its ancestors already skipped over,
+	// make sure the next change walks down to it again.
+	Node3D *p = data.parent;
+	while (p && p->data.propagated_pass != 0) {
+		p->data.propagated_pass = 0;
+		p = p->data.parent;
+	}
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -146,6 +163,7 @@ void Node3D::_notification(int p_what) {
 
 			data.dirty |= DIRTY_GLOBAL; //global is always dirty upon entering a scene
 			_notify_dirty();
+			_invalidate_transform_propagation();
 
 			notification(NOTIFICATION_ENTER_WORLD);
 
@@ -153,7 +171,7 @@ void Node3D::_notification(int p_what) {
 		case NOTIFICATION_EXIT_TREE: {
 			notification(NOTIFICATION_EXIT_WORLD, true);
 			if (xform_change.in_list()) {
-				get_tree()->xform_change_list.remove(&xform_change);
+				get_tree()->_remove_xform_change(&xform_change);
 			}
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
@@ -407,6 +425,7 @@ void Node3D::set_gizmo(const Ref<Node3DGizmo> &p_gizmo) {
 		data.gizmo->free();
 	}
 	data.gizmo = p_gizmo;
+	_invalidate_transform_propagation();
 	if (data.gizmo.is_valid() && is_inside_world()) {
 		data.gizmo->create();
 		if (is_visible_in_tree()) {
@@ -676,6 +695,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enable) {
 	data.notify_transform = p_enable;
+	_invalidate_transform_propagation();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -695,7 +715,7 @@ void Node3D::force_update_transform() {
 	if (!xform_change.in_list()) {
 		return; //nothing to update
 	}
-	get_tree()->xform_change_list.remove(&xform_change);
+	get_tree()->_remove_xform_change(&xform_change);
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
@@ -785,6 +805,7 @@ void Node3D::_bind_methods() {
 Node3D::Node3D() :
 		xform_change(this) {
 	data.dirty = DIRTY_NONE;
+	data.propagated_pass = 0;
 	data.children_lock = 0;
 
 	data.ignore_notification = false;
@@ -68,6 +68,7 @@ class Node3D : public Node {
 		mutable Vector3 scale;
 
 		mutable int dirty;
+		uint64_t propagated_pass; // SceneTree::xform_pass when the change was last propagated to the children.
 
 		Viewport *viewport;
 
@@ -98,6 +99,7 @@ class Node3D : public Node {
 	void _update_gizmo();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
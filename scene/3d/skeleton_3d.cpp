@@ -31,10 +31,12 @@
 #include "skeleton_3d.h"
 
 #include "core/engine.h"
+#include "core/local_vector.h"
 #include "core/message_queue.h"
 #include "core/project_settings.h"
 #include "core/type_info.h"
 #include "scene/3d/physics_body_3d.h"
+#include "scene/main/scene_tree.h"
 #include "scene/resources/surface_tool.h"
 
 void SkinReference::_skin_changed() {
@@ -220,137 +222,232 @@ void Skeleton3D::_update_process_order() {
 	process_order_dirty = false;
 }
 
-void Skeleton3D::_notification(int p_what) {
-	switch (p_what) {
-		case NOTIFICATION_UPDATE_SKELETON: {
-			RenderingServer *vs = RenderingServer::get_singleton();
-			Bone *bonesptr = bones.ptrw();
-			int len = bones.size();
+SelfList<Skeleton3D>::List Skeleton3D::dirty_skeletons;
+Mutex Skeleton3D::dirty_skeletons_mutex;
 
-			_update_process_order();
+void Skeleton3D::_prepare_update() {
+	// Everything that touches the servers or other objects happens here, on
+	// the calling thread, so _update_bone_poses() can run on a worker.
+	MutexLock lock(dirty_skeletons_mutex);
+	dirty_list.remove_from_list();
 
-			const int *order = process_order.ptr();
+	_update_process_order();
 
-			for (int i = 0; i < len; i++) {
-				Bone &b = bonesptr[order[i]];
+	Bone *bonesptr = bones.ptrw(); // Make the bone data unique before it is shared with workers.
+	int len = bones.size();
 
-				if (b.global_pose_override_amount >= 0.999) {
-					b.pose_global = b.global_pose_override;
-				} else {
-					if (b.disable_rest) {
-						if (b.enabled) {
-							Transform pose = b.pose;
-							if (b.custom_pose_enable) {
-								pose = b.custom_pose * pose;
-							}
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * pose;
-							} else {
-								b.pose_global = pose;
-							}
-						} else {
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global;
-							} else {
-								b.pose_global = Transform();
-							}
-						}
+	for (Set<SkinReference *>::Element *E = skin_bindings.front(); E; E = E->next()) {
+		const Skin *skin = E->get()->skin.operator->();
+		RID skeleton = E->get()->skeleton;
+		uint32_t bind_count = skin->get_bind_count();
+
+		if (E->get()->bind_count != bind_count) {
+			RS::get_singleton()->skeleton_allocate(skeleton, bind_count);
+			E->get()->bind_count = bind_count;
+			E->get()->skin_bone_indices.resize(bind_count);
+			E->get()->skin_bone_indices_ptrs = E->get()->skin_bone_indices.ptrw();
+		}
 
-					} else {
-						if (b.enabled) {
-							Transform pose = b.pose;
-							if (b.custom_pose_enable) {
-								pose = b.custom_pose * pose;
-							}
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * (b.rest * pose);
-							} else {
-								b.pose_global = b.rest * pose;
-							}
-						} else {
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * b.rest;
-							} else {
-								b.pose_global = b.rest;
-							}
+		if (E->get()->skeleton_version != version) {
+			for (uint32_t i = 0; i < bind_count; i++) {
+				StringName bind_name = skin->get_bind_name(i);
+
+				if (bind_name != StringName()) {
+					//bind name used, use this
+					bool found = false;
+					for (int j = 0; j < len; j++) {
+						if (bonesptr[j].name == bind_name) {
+							E->get()->skin_bone_indices_ptrs[i] = j;
+							found = true;
+							break;
 						}
 					}
 
-					if (b.global_pose_override_amount >= CMP_EPSILON) {
-						b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+					if (!found) {
+						ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton has no bone by that name.");
+						E->get()->skin_bone_indices_ptrs[i] = 0;
+					}
+				} else if (skin->get_bind_bone(i) >= 0) {
+					int bind_index = skin->get_bind_bone(i);
+					if (bind_index >= len) {
+						ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
+						E->get()->skin_bone_indices_ptrs[i] = 0;
+					} else {
+						E->get()->skin_bone_indices_ptrs[i] = bind_index;
 					}
+				} else {
+					ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
+					E->get()->skin_bone_indices_ptrs[i] = 0;
 				}
+			}
+
+			E->get()->skeleton_version = version;
+		}
+
+		E->get()->bone_buffer.resize(bind_count * 12);
+	}
+}
+
+void Skeleton3D::_update_bone_poses() {
+	Bone *bonesptr = bones.ptrw();
+	int len = bones.size();
 
-				if (b.global_pose_override_reset) {
-					b.global_pose_override_amount = 0.0;
+	const int *order = process_order.ptr();
+
+	for (int i = 0; i < len; i++) {
+		Bone &b = bonesptr[order[i]];
+
+		if (b.global_pose_override_amount >= 0.999) {
+			b.pose_global = b.global_pose_override;
+		} else {
+			if (b.disable_rest) {
+				if (b.enabled) {
+					Transform pose = b.pose;
+					if (b.custom_pose_enable) {
+						pose = b.custom_pose * pose;
+					}
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global * pose;
+					} else {
+						b.pose_global = pose;
+					}
+				} else {
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global;
+					} else {
+						b.pose_global = Transform();
+					}
 				}
 
-				for (List<ObjectID>::Element *E = b.nodes_bound.front(); E; E = E->next()) {
-					Object *obj = ObjectDB::get_instance(E->get());
-					ERR_CONTINUE(!obj);
-					Node3D *sp = Object::cast_to<Node3D>(obj);
-					ERR_CONTINUE(!sp);
-					sp->set_transform(b.pose_global);
+			} else {
+				if (b.enabled) {
+					Transform pose = b.pose;
+					if (b.custom_pose_enable) {
+						pose = b.custom_pose * pose;
+					}
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global * (b.rest * pose);
+					} else {
+						b.pose_global = b.rest * pose;
+					}
+				} else {
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global * b.rest;
+					} else {
+						b.pose_global = b.rest;
+					}
 				}
 			}
 
-			//update skins
-			for (Set<SkinReference *>::Element *E = skin_bindings.front(); E; E = E->next()) {
-				const Skin *skin = E->get()->skin.operator->();
-				RID skeleton = E->get()->skeleton;
-				uint32_t bind_count = skin->get_bind_count();
-
-				if (E->get()->bind_count != bind_count) {
-					RS::get_singleton()->skeleton_allocate(skeleton, bind_count);
-					E->get()->bind_count = bind_count;
-					E->get()->skin_bone_indices.resize(bind_count);
-					E->get()->skin_bone_indices_ptrs = E->get()->skin_bone_indices.ptrw();
-				}
+			if (b.global_pose_override_amount >= CMP_EPSILON) {
+				b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+			}
+		}
 
-				if (E->get()->skeleton_version != version) {
-					for (uint32_t i = 0; i < bind_count; i++) {
-						StringName bind_name = skin->get_bind_name(i);
-
-						if (bind_name != StringName()) {
-							//bind name used, use this
-							bool found = false;
-							for (int j = 0; j < len; j++) {
-								if (bonesptr[j].name == bind_name) {
-									E->get()->skin_bone_indices_ptrs[i] = j;
-									found = true;
-									break;
-								}
-							}
-
-							if (!found) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton has no bone by that name.");
-								E->get()->skin_bone_indices_ptrs[i] = 0;
-							}
-						} else if (skin->get_bind_bone(i) >= 0) {
-							int bind_index = skin->get_bind_bone(i);
-							if (bind_index >= len) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
-								E->get()->skin_bone_indices_ptrs[i] = 0;
-							} else {
-								E->get()->skin_bone_indices_ptrs[i] = bind_index;
-							}
-						} else {
-							ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
-							E->get()->skin_bone_indices_ptrs[i] = 0;
-						}
-					}
+		if (b.global_pose_override_reset) {
+			b.global_pose_override_amount = 0.0;
+		}
+	}
 
-					E->get()->skeleton_version = version;
-				}
+	for (Set<SkinReference *>::Element *E = skin_bindings.front(); E; E = E->next()) {
+		const Skin *skin = E->get()->skin.operator->();
+		uint32_t bind_count = E->get()->bind_count;
+		const uint32_t *indices = E->get()->skin_bone_indices_ptrs;
+		float *dataptr = E->get()->bone_buffer.ptrw();
+
+		for (uint32_t i = 0; i < bind_count; i++) {
+			uint32_t bone_index = indices[i];
+			ERR_CONTINUE(bone_index >= (uint32_t)len);
+			Transform t = bonesptr[bone_index].pose_global * skin->get_bind_pose(i);
+
+			float *row = &dataptr[i * 12];
+			row[0] = t.basis.elements[0][0];
+			row[1] = t.basis.elements[0][1];
+			row[2] = t.basis.elements[0][2];
+			row[3] = t.origin.x;
+			row[4] = t.basis.elements[1][0];
+			row[5] = t.basis.elements[1][1];
+			row[6] = t.basis.elements[1][2];
+			row[7] = t.origin.y;
+			row[8] = t.basis.elements[2][0];
+			row[9] = t.basis.elements[2][1];
+			row[10] = t.basis.elements[2][2];
+			row[11] = t.origin.z;
+		}
+	}
+}
 
-				for (uint32_t i = 0; i < bind_count; i++) {
-					uint32_t bone_index = E->get()->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					vs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
-				}
+void Skeleton3D::_finish_update() {
+	const Bone *bonesptr = bones.ptr();
+	int len = bones.size();
+
+	for (int i = 0; i < len; i++) {
+		const Bone &b = bonesptr[i];
+		for (const List<ObjectID>::Element *E = b.nodes_bound.front(); E; E = E->next()) {
+			Object *obj = ObjectDB::get_instance(E->get());
+			ERR_CONTINUE(!obj);
+			Node3D *sp = Object::cast_to<Node3D>(obj);
+			ERR_CONTINUE(!sp);
+			sp->set_transform(b.pose_global);
+		}
+	}
+
+	RenderingServer *vs = RenderingServer::get_singleton();
+	for (Set<SkinReference *>::Element *E = skin_bindings.front(); E; E = E->next()) {
+		// Whole pose in one call instead of one queued command per bone.
+		vs->skeleton_set_bone_buffer(E->get()->skeleton, E->get()->bone_buffer);
+	}
+
+	dirty = false;
+}
+
+void Skeleton3D::_update_skeleton() {
+	_prepare_update();
+	_update_bone_poses();
+	_finish_update();
+}
+
+void Skeleton3D::UpdateJob::update(uint32_t p_index, Skeleton3D **p_skeletons) {
+	p_skeletons[p_index]->_update_bone_poses();
+}
+
+void Skeleton3D::_update_dirty_skeletons() {
+	LocalVector<Skeleton3D *> skeletons;
+	{
+		MutexLock lock(dirty_skeletons_mutex);
+		while (dirty_skeletons.first()) {
+			Skeleton3D *skeleton = dirty_skeletons.first()->self();
+			skeleton->_prepare_update(); // Removes it from the list.
+			skeletons.push_back(skeleton);
+		}
+	}
+
+	uint32_t count = skeletons.size();
+	ThreadWorkPool *pool = SceneTree::get_singleton() ? SceneTree::get_singleton()->get_thread_work_pool() : nullptr;
+
+	if (pool && count >= PARALLEL_UPDATE_MIN_SKELETONS) {
+		// Skeletons share no data, so each one is evaluated as an independent job.
+		UpdateJob job;
+		pool->do_work(count, &job, &UpdateJob::update, &skeletons[0]);
+	} else {
+		for (uint32_t i = 0; i < count; i++) {
+			skeletons[i]->_update_bone_poses();
+		}
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		skeletons[i]->_finish_update();
+	}
+}
+
+void Skeleton3D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_UPDATE_SKELETON: {
+			if (!dirty) {
+				break; // Already updated together with other dirty skeletons.
 			}
 
-			dirty = false;
+			_update_dirty_skeletons();
 		} break;
 
 #ifndef _3D_DISABLED
@@ -394,7 +491,7 @@ void Skeleton3D::set_bone_global_pose_override(int p_bone, const Transform &p_po
 Transform Skeleton3D::get_bone_global_pose(int p_bone) const {
 	ERR_FAIL_INDEX_V(p_bone, bones.size(), Transform());
 	if (dirty) {
-		const_cast<Skeleton3D *>(this)->notification(NOTIFICATION_UPDATE_SKELETON);
+		const_cast<Skeleton3D *>(this)->_update_skeleton();
 	}
 	return bones[p_bone].pose_global;
 }
@@ -593,8 +690,12 @@ void Skeleton3D::_make_dirty() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_notification(this, NOTIFICATION_UPDATE_SKELETON);
 	dirty = true;
+	{
+		MutexLock lock(dirty_skeletons_mutex);
+		dirty_skeletons.add(&dirty_list);
+	}
+	MessageQueue::get_singleton()->push_notification(this, NOTIFICATION_UPDATE_SKELETON);
 }
 
 int Skeleton3D::get_process_order(int p_idx) {
@@ -896,7 +997,8 @@ void Skeleton3D::_bind_methods() {
 	BIND_CONSTANT(NOTIFICATION_UPDATE_SKELETON);
 }
 
-Skeleton3D::Skeleton3D() {
+Skeleton3D::Skeleton3D() :
+		dirty_list(this) {
 	animate_physical_bones = true;
 	dirty = false;
 	version = 1;
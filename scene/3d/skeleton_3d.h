@@ -31,7 +31,9 @@
 #ifndef SKELETON_3D_H
 #define SKELETON_3D_H
 
+#include "core/os/mutex.h"
 #include "core/rid.h"
+#include "core/self_list.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/skin.h"
 
@@ -54,6 +56,7 @@ class SkinReference : public Reference {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs;
+	Vector<float> bone_buffer; // Skinning matrices in the layout of RS::skeleton_set_bone_buffer().
 	void _skin_changed();
 
 protected:
@@ -124,6 +127,25 @@ private:
 	void _make_dirty();
 	bool dirty;
 
+	// Dirty skeletons are updated together, so their poses can be evaluated in parallel.
+	enum {
+		PARALLEL_UPDATE_MIN_SKELETONS = 8
+	};
+
+	SelfList<Skeleton3D> dirty_list;
+	static SelfList<Skeleton3D>::List dirty_skeletons;
+	static Mutex dirty_skeletons_mutex; // Skeletons can be posed from sub thread process callbacks.
+
+	struct UpdateJob {
+		void update(uint32_t p_index, Skeleton3D **p_skeletons);
+	};
+
+	void _prepare_update();
+	void _update_bone_poses();
+	void _finish_update();
+	void _update_skeleton();
+	static void _update_dirty_skeletons();
+
 	uint64_t version;
 
 	// bind helpers
@@ -0,0 +1,220 @@
+/*************************************************************************/
+/*  animation_lod.cpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "animation_lod.h"
+
+#include "scene/3d/camera_3d.h"
+#include "scene/3d/visibility_notifier_3d.h"
+#include "scene/main/viewport.h"
+
+void AnimationLOD::set_distances(const Vector<float> &p_distances) {
+	distances = p_distances;
+	distances.sort();
+	emit_changed();
+}
+
+Vector<float> AnimationLOD::get_distances() const {
+	return distances;
+}
+
+void AnimationLOD::set_update_intervals(const Vector<int> &p_intervals) {
+	update_intervals = p_intervals;
+	emit_changed();
+}
+
+Vector<int> AnimationLOD::get_update_intervals() const {
+	return update_intervals;
+}
+
+void AnimationLOD::set_offscreen_update_interval(int p_interval) {
+	ERR_FAIL_COND(p_interval < 1);
+	offscreen_update_interval = p_interval;
+	emit_changed();
+}
+
+int AnimationLOD::get_offscreen_update_interval() const {
+	return offscreen_update_interval;
+}
+
+void AnimationLOD::set_reduced_tracks_level(int p_level) {
+	reduced_tracks_level = p_level;
+	emit_changed();
+}
+
+int AnimationLOD::get_reduced_tracks_level() const {
+	return reduced_tracks_level;
+}
+
+void AnimationLOD::set_interpolation_enabled(bool p_enabled) {
+	interpolation = p_enabled;
+	emit_changed();
+}
+
+bool AnimationLOD::is_interpolation_enabled() const {
+	return interpolation;
+}
+
+void AnimationLOD::set_update_budget(int p_budget) {
+	ERR_FAIL_COND(p_budget < 0);
+	update_budget = p_budget;
+	emit_changed();
+}
+
+int AnimationLOD::get_update_budget() const {
+	return update_budget;
+}
+
+int AnimationLOD::get_level_for_distance(float p_distance) const {
+	int level = 0;
+	while (level < distances.size() && p_distance >= distances[level]) {
+		level++;
+	}
+	return level;
+}
+
+int AnimationLOD::get_update_interval_for_level(int p_level) const {
+	if (update_intervals.empty()) {
+		return 1;
+	}
+	return MAX(1, update_intervals[MIN(p_level, update_intervals.size() - 1)]);
+}
+
+bool AnimationLOD::consume_update_budget(uint64_t p_frame) const {
+	if (update_budget == 0) {
+		return true;
+	}
+
+	budget_lock.lock();
+	if (budget_frame != p_frame) {
+		budget_frame = p_frame;
+		budget_used = 0;
+	}
+	bool available = budget_used < update_budget;
+	if (available) {
+		budget_used++;
+	}
+	budget_lock.unlock();
+
+	return available;
+}
+
+void AnimationLOD::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_distances", "distances"), &AnimationLOD::set_distances);
+	ClassDB::bind_method(D_METHOD("get_distances"), &AnimationLOD::get_distances);
+
+	ClassDB::bind_method(D_METHOD("set_update_intervals", "intervals"), &AnimationLOD::set_update_intervals);
+	ClassDB::bind_method(D_METHOD("get_update_intervals"), &AnimationLOD::get_update_intervals);
+
+	ClassDB::bind_method(D_METHOD("set_offscreen_update_interval", "interval"), &AnimationLOD::set_offscreen_update_interval);
+	ClassDB::bind_method(D_METHOD("get_offscreen_update_interval"), &AnimationLOD::get_offscreen_update_interval);
+
+	ClassDB::bind_method(D_METHOD("set_reduced_tracks_level", "level"), &AnimationLOD::set_reduced_tracks_level);
+	ClassDB::bind_method(D_METHOD("get_reduced_tracks_level"), &AnimationLOD::get_reduced_tracks_level);
+
+	ClassDB::bind_method(D_METHOD("set_interpolation_enabled", "enabled"), &AnimationLOD::set_interpolation_enabled);
+	ClassDB::bind_method(D_METHOD("is_interpolation_enabled"), &AnimationLOD::is_interpolation_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_update_budget", "budget"), &AnimationLOD::set_update_budget);
+	ClassDB::bind_method(D_METHOD("get_update_budget"), &AnimationLOD::get_update_budget);
+
+	ClassDB::bind_method(D_METHOD("get_level_for_distance", "distance"), &AnimationLOD::get_level_for_distance);
+	ClassDB::bind_method(D_METHOD("get_update_interval_for_level", "level"), &AnimationLOD::get_update_interval_for_level);
+
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "distances"), "set_distances", "get_distances");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "update_intervals"), "set_update_intervals", "get_update_intervals");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "offscreen_update_interval", PROPERTY_HINT_RANGE, "1,64,1"), "set_offscreen_update_interval", "get_offscreen_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "reduced_tracks_level", PROPERTY_HINT_RANGE, "0,16,1"), "set_reduced_tracks_level", "get_reduced_tracks_level");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "interpolation"), "set_interpolation_enabled", "is_interpolation_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "update_budget", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_update_budget", "get_update_budget");
+}
+
+AnimationLOD::AnimationLOD() {
+	distances.push_back(20);
+	distances.push_back(50);
+
+	update_intervals.push_back(1);
+	update_intervals.push_back(2);
+	update_intervals.push_back(4);
+}
+
+bool AnimationLODState::process(const AnimationLOD *p_lod, Node *p_target, Node *p_visibility_notifier, uint64_t p_frame, uint32_t p_phase, float p_delta, float &r_delta) {
+	delta_accum += p_delta;
+
+	level = 0;
+	bool on_screen = true;
+
+#ifndef _3D_DISABLED
+	VisibilityNotifier3D *notifier = Object::cast_to<VisibilityNotifier3D>(p_visibility_notifier);
+	if (notifier) {
+		on_screen = notifier->is_on_screen();
+	}
+
+	Node3D *target = Object::cast_to<Node3D>(p_target);
+	if (target && target->is_inside_tree()) {
+		Camera3D *camera = target->get_viewport()->get_camera();
+		if (camera) {
+			float distance = camera->get_camera_transform().origin.distance_to(target->get_global_transform().origin);
+			level = p_lod->get_level_for_distance(distance);
+		}
+	}
+#endif // _3D_DISABLED
+
+	if (on_screen) {
+		interval = p_lod->get_update_interval_for_level(level);
+		reduced_tracks = level >= p_lod->get_reduced_tracks_level();
+	} else {
+		interval = p_lod->get_offscreen_update_interval();
+		reduced_tracks = true;
+	}
+
+	if (interval > 1 && (p_frame + p_phase) % interval != 0 && frames_since_update + 1 < interval) {
+		frames_since_update++;
+		return false;
+	}
+
+	// Over budget, throttled updates are deferred to the next frame, but by one interval at most.
+	if (interval > 1 && !p_lod->consume_update_budget(p_frame) && frames_since_update + 1 < interval * 2) {
+		frames_since_update++;
+		return false;
+	}
+
+	r_delta = delta_accum;
+	delta_accum = 0.0;
+	frames_since_update = 0;
+	return true;
+}
+
+void AnimationLODState::reset() {
+	level = 0;
+	interval = 1;
+	frames_since_update = 0;
+	reduced_tracks = false;
+	delta_accum = 0.0;
+}
@@ -0,0 +1,103 @@
+/*************************************************************************/
+/*  animation_lod.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef ANIMATION_LOD_H
+#define ANIMATION_LOD_H
+
+#include "core/resource.h"
+#include "core/spin_lock.h"
+
+class Node;
+
+// Level of detail settings shared by many AnimationPlayers and AnimationTrees.
+// The level is picked from the distance between the camera and the animated
+// node; lower levels sample and apply their tracks only every few frames.
+class AnimationLOD : public Resource {
+	GDCLASS(AnimationLOD, Resource);
+
+	Vector<float> distances;
+	Vector<int> update_intervals;
+	int offscreen_update_interval = 8;
+	int reduced_tracks_level = 2;
+	bool interpolation = true;
+	int update_budget = 0;
+
+	// Throttled updates taken in budget_frame by all the nodes sharing these settings.
+	mutable SpinLock budget_lock;
+	mutable uint64_t budget_frame = 0;
+	mutable int budget_used = 0;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_distances(const Vector<float> &p_distances);
+	Vector<float> get_distances() const;
+
+	void set_update_intervals(const Vector<int> &p_intervals);
+	Vector<int> get_update_intervals() const;
+
+	void set_offscreen_update_interval(int p_interval);
+	int get_offscreen_update_interval() const;
+
+	void set_reduced_tracks_level(int p_level);
+	int get_reduced_tracks_level() const;
+
+	void set_interpolation_enabled(bool p_enabled);
+	bool is_interpolation_enabled() const;
+
+	void set_update_budget(int p_budget);
+	int get_update_budget() const;
+
+	int get_level_for_distance(float p_distance) const;
+	int get_update_interval_for_level(int p_level) const;
+
+	// Returns false if the throttled updates of frame p_frame already used up the budget.
+	bool consume_update_budget(uint64_t p_frame) const;
+
+	AnimationLOD();
+};
+
+// Per node throttling state, used by AnimationPlayer and AnimationTree.
+struct AnimationLODState {
+	int level = 0;
+	int interval = 1;
+	int frames_since_update = 0;
+	bool reduced_tracks = false;
+	float delta_accum = 0.0;
+
+	// Returns true if the animation must be sampled this frame, in which case r_delta
+	// is the time elapsed since the last sampled frame. p_phase spreads the updates
+	// of nodes on the same interval across frames.
+	bool process(const AnimationLOD *p_lod, Node *p_target, Node *p_visibility_notifier, uint64_t p_frame, uint32_t p_phase, float p_delta, float &r_delta);
+	void reset();
+};
+
+#endif // ANIMATION_LOD_H
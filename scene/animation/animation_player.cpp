@@ -194,8 +194,9 @@ void AnimationPlayer::_notification(int p_what) {
 				break;
 			}
 
-			if (processing) {
-				_animation_process(get_process_delta_time());
+			float delta;
+			if (processing && _lod_should_process(get_process_delta_time(), delta)) {
+				_animation_process(delta);
 			}
 		} break;
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
@@ -203,8 +204,9 @@ void AnimationPlayer::_notification(int p_what) {
 				break;
 			}
 
-			if (processing) {
-				_animation_process(get_physics_process_delta_time());
+			float delta;
+			if (processing && _lod_should_process(get_physics_process_delta_time(), delta)) {
+				_animation_process(delta);
 			}
 		} break;
 		case NOTIFICATION_EXIT_TREE: {
@@ -226,6 +228,10 @@ void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 	Animation *a = p_anim->animation.operator->();
 
 	p_anim->node_cache.resize(a->get_track_count());
+	p_anim->key_cursors.resize(a->get_track_count());
+	for (uint32_t i = 0; i < p_anim->key_cursors.size(); i++) {
+		p_anim->key_cursors[i] = -1;
+	}
 
 	for (int i = 0; i < a->get_track_count(); i++) {
 		p_anim->node_cache.write[i] = nullptr;
@@ -359,7 +365,8 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 				Quat rot;
 				Vector3 scale;
 
-				Error err = a->transform_track_interpolate(i, p_time, &loc, &rot, &scale);
+				int *cursor = i < (int)p_anim->key_cursors.size() ? &p_anim->key_cursors[i] : nullptr;
+				Error err = a->transform_track_interpolate(i, p_time, &loc, &rot, &scale, cursor);
 				//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 				if (err != OK) {
@@ -386,6 +393,10 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 					continue;
 				}
 
+				if (lod_reduce_tracks && a->value_track_get_update_mode(i) == Animation::UPDATE_CONTINUOUS) {
+					continue; // skipped at low levels of detail
+				}
+
 				//StringName property=a->track_get_path(i).get_property();
 
 				Map<StringName, TrackNodeCache::PropertyAnim>::Element *E = nc->property_anim.find(a->track_get_path(i).get_concatenated_subnames());
@@ -560,7 +571,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 
 			} break;
 			case Animation::TYPE_BEZIER: {
-				if (!nc->node) {
+				if (!nc->node || lod_reduce_tracks) {
 					continue;
 				}
 
@@ -822,7 +833,89 @@ void AnimationPlayer::_animation_process2(float p_delta, bool p_started) {
 	}
 }
 
+bool AnimationPlayer::_lod_should_process(float p_delta, float &r_delta) {
+	if (lod.is_null() || playback.started || playback.seeked) {
+		if (lod_state.delta_accum != 0.0) {
+			p_delta += lod_state.delta_accum;
+			lod_state.reset();
+		}
+		lod_caches.clear();
+		r_delta = p_delta;
+		return true;
+	}
+
+	Node *target = has_node(root) ? get_node(root) : nullptr;
+	Node *notifier = lod_visibility_notifier.is_empty() ? nullptr : get_node_or_null(lod_visibility_notifier);
+	uint64_t frame = animation_process_mode == ANIMATION_PROCESS_PHYSICS ? Engine::get_singleton()->get_physics_frames() : Engine::get_singleton()->get_idle_frames();
+
+	if (!lod_state.process(lod.ptr(), target, notifier, frame, uint32_t(uint64_t(get_instance_id())), p_delta, r_delta)) {
+		if (lod_caches.size()) {
+			_animation_interpolate_transforms();
+		}
+		return false;
+	}
+
+	lod_reduce_tracks = lod_state.reduced_tracks;
+	lod_interpolate = lod->is_interpolation_enabled() && lod_state.interval > 1;
+	return true;
+}
+
+void AnimationPlayer::_animation_interpolate_transforms() {
+	lod_step++;
+	float c = MIN(float(lod_step) / lod_state.interval, 1.0f);
+
+	Transform t;
+	for (uint32_t i = 0; i < lod_caches.size(); i++) {
+		TrackNodeCache *nc = lod_caches[i];
+
+		nc->lod_loc = nc->lod_loc_from.lerp(nc->loc_accum, c);
+		nc->lod_rot = nc->lod_rot_from.slerp(nc->rot_accum, c);
+		nc->lod_scale = nc->lod_scale_from.lerp(nc->scale_accum, c);
+
+		t.origin = nc->lod_loc;
+		t.basis.set_quat_scale(nc->lod_rot, nc->lod_scale);
+		if (nc->skeleton && nc->bone_idx >= 0) {
+			nc->skeleton->set_bone_pose(nc->bone_idx, t);
+
+		} else if (nc->spatial) {
+			nc->spatial->set_transform(t);
+		}
+	}
+}
+
 void AnimationPlayer::_animation_update_transforms() {
+	if (lod_interpolate) {
+		// Ease from what is shown now to the new pose over the frames until the next update.
+		for (int i = 0; i < cache_update_size; i++) {
+			TrackNodeCache *nc = cache_update[i];
+
+			ERR_CONTINUE(nc->accum_pass != accum_pass);
+
+			if (lod_caches.empty() || nc->lod_pass != lod_pass) {
+				nc->lod_loc = nc->loc_accum;
+				nc->lod_rot = nc->rot_accum;
+				nc->lod_scale = nc->scale_accum;
+			}
+
+			nc->lod_loc_from = nc->lod_loc;
+			nc->lod_rot_from = nc->lod_rot;
+			nc->lod_scale_from = nc->lod_scale;
+			nc->lod_pass = accum_pass;
+		}
+
+		lod_caches.resize(cache_update_size);
+		for (int i = 0; i < cache_update_size; i++) {
+			lod_caches[i] = cache_update[i];
+		}
+		lod_pass = accum_pass;
+		lod_step = 0;
+		cache_update_size = 0;
+
+		_animation_interpolate_transforms();
+	} else {
+		lod_caches.clear();
+	}
+
 	{
 		Transform t;
 		for (int i = 0; i < cache_update_size; i++) {
@@ -898,6 +991,9 @@ void AnimationPlayer::_animation_update_transforms() {
 	}
 
 	cache_update_bezier_size = 0;
+
+	lod_reduce_tracks = false;
+	lod_interpolate = false;
 }
 
 void AnimationPlayer::_animation_process(float p_delta) {
@@ -1337,8 +1433,10 @@ void AnimationPlayer::clear_caches() {
 
 	for (Map<StringName, AnimationData>::Element *E = animation_set.front(); E; E = E->next()) {
 		E->get().node_cache.clear();
+		E->get().key_cursors.clear();
 	}
 
+	lod_caches.clear();
 	cache_update_size = 0;
 	cache_update_prop_size = 0;
 	cache_update_bezier_size = 0;
@@ -1454,6 +1552,28 @@ NodePath AnimationPlayer::get_root() const {
 	return root;
 }
 
+void AnimationPlayer::set_lod_settings(const Ref<AnimationLOD> &p_lod) {
+	lod = p_lod;
+	lod_state.reset();
+	lod_caches.clear();
+}
+
+Ref<AnimationLOD> AnimationPlayer::get_lod_settings() const {
+	return lod;
+}
+
+void AnimationPlayer::set_lod_visibility_notifier(const NodePath &p_path) {
+	lod_visibility_notifier = p_path;
+}
+
+NodePath AnimationPlayer::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
+int AnimationPlayer::get_lod_level() const {
+	return lod.is_valid() ? lod_state.level : 0;
+}
+
 void AnimationPlayer::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 #ifdef TOOLS_ENABLED
 	const String quote_style = EDITOR_DEF("text_editor/completion/use_single_quotes", 0) ? "'" : "\"";
@@ -1580,6 +1700,13 @@ void AnimationPlayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root", "path"), &AnimationPlayer::set_root);
 	ClassDB::bind_method(D_METHOD("get_root"), &AnimationPlayer::get_root);
 
+	ClassDB::bind_method(D_METHOD("set_lod_settings", "settings"), &AnimationPlayer::set_lod_settings);
+	ClassDB::bind_method(D_METHOD("get_lod_settings"), &AnimationPlayer::get_lod_settings);
+
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "path"), &AnimationPlayer::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationPlayer::get_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_level"), &AnimationPlayer::get_lod_level);
+
 	ClassDB::bind_method(D_METHOD("find_animation", "animation"), &AnimationPlayer::find_animation);
 
 	ClassDB::bind_method(D_METHOD("clear_caches"), &AnimationPlayer::clear_caches);
@@ -1610,6 +1737,10 @@ void AnimationPlayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "playback_speed", PROPERTY_HINT_RANGE, "-64,64,0.01"), "set_speed_scale", "get_speed_scale");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "method_call_mode", PROPERTY_HINT_ENUM, "Deferred,Immediate"), "set_method_call_mode", "get_method_call_mode");
 
+	ADD_GROUP("Level of Detail", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "lod_settings", PROPERTY_HINT_RESOURCE_TYPE, "AnimationLOD"), "set_lod_settings", "get_lod_settings");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "VisibilityNotifier3D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
+
 	ADD_SIGNAL(MethodInfo("animation_finished", PropertyInfo(Variant::STRING_NAME, "anim_name")));
 	ADD_SIGNAL(MethodInfo("animation_changed", PropertyInfo(Variant::STRING_NAME, "old_name"), PropertyInfo(Variant::STRING_NAME, "new_name")));
 	ADD_SIGNAL(MethodInfo("animation_started", PropertyInfo(Variant::STRING_NAME, "anim_name")));
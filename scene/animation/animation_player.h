@@ -31,6 +31,8 @@
 #ifndef ANIMATION_PLAYER_H
 #define ANIMATION_PLAYER_H
 
+#include "animation_lod.h"
+#include "core/local_vector.h"
 #include "scene/2d/node_2d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
@@ -100,6 +102,16 @@ private:
 		Vector3 scale_accum;
 		uint64_t accum_pass = 0;
 
+		// transforms shown between sparse updates when the level of detail interpolates
+
+		Vector3 lod_loc_from;
+		Quat lod_rot_from;
+		Vector3 lod_scale_from;
+		Vector3 lod_loc;
+		Quat lod_rot;
+		Vector3 lod_scale;
+		uint64_t lod_pass = 0;
+
 		bool audio_playing = false;
 		float audio_start = 0.0;
 		float audio_len = 0.0;
@@ -166,6 +178,7 @@ private:
 		String name;
 		StringName next;
 		Vector<TrackNodeCache *> node_cache;
+		LocalVector<int> key_cursors; // Last key sampled on each track, to speed up the next lookup.
 		Ref<Animation> animation;
 	};
 
@@ -228,6 +241,18 @@ private:
 	void _ensure_node_caches(AnimationData *p_anim);
 	void _animation_process_data(PlaybackData &cd, float p_delta, float p_blend, bool p_seeked, bool p_started);
 	void _animation_process2(float p_delta, bool p_started);
+	Ref<AnimationLOD> lod;
+	NodePath lod_visibility_notifier;
+	AnimationLODState lod_state;
+	bool lod_reduce_tracks = false;
+	bool lod_interpolate = false;
+	LocalVector<TrackNodeCache *> lod_caches; // Transforms interpolated until the next update.
+	uint64_t lod_pass = 0;
+	int lod_step = 0;
+
+	bool _lod_should_process(float p_delta, float &r_delta);
+	void _animation_interpolate_transforms();
+
 	void _animation_update_transforms();
 	void _animation_process(float p_delta);
 
@@ -321,6 +346,13 @@ public:
 	void set_root(const NodePath &p_root);
 	NodePath get_root() const;
 
+	void set_lod_settings(const Ref<AnimationLOD> &p_lod);
+	Ref<AnimationLOD> get_lod_settings() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_path);
+	NodePath get_lod_visibility_notifier() const;
+	int get_lod_level() const;
+
 	void clear_caches(); ///< must be called by hand if an animation was modified after added
 
 	void get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const;
@@ -32,7 +32,9 @@
 
 #include "animation_blend_tree.h"
 #include "core/engine.h"
+#include "core/message_queue.h"
 #include "core/method_bind_ext.gen.inc"
+#include "scene/main/scene_tree.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
 
@@ -691,11 +693,14 @@ bool AnimationTree::_update_caches(AnimationPlayer *player) {
 	}
 
 	state.track_map.clear();
+	track_list.clear();
+	track_bindings.clear();
 
 	K = nullptr;
 	int idx = 0;
 	while ((K = track_cache.next(K))) {
 		state.track_map[*K] = idx;
+		track_list.push_back(track_cache[*K]);
 		idx++;
 	}
 
@@ -707,6 +712,8 @@ bool AnimationTree::_update_caches(AnimationPlayer *player) {
 }
 
 void AnimationTree::_clear_caches() {
+	_cancel_pending_blend();
+
 	const NodePath *K = nullptr;
 	while ((K = track_cache.next(K))) {
 		memdelete(track_cache[*K]);
@@ -714,15 +721,21 @@ void AnimationTree::_clear_caches() {
 	playing_caches.clear();
 
 	track_cache.clear();
+	track_list.clear();
+	track_bindings.clear();
 	cache_valid = false;
 }
 
-void AnimationTree::_process_graph(float p_delta) {
+void AnimationTree::_process_graph(float p_delta, bool p_deferred) {
 	_update_properties(); //if properties need updating, update them
 
+	_cancel_pending_blend(); // Superseded by this pass.
+
 	//check all tracks, see if they need modification
 
-	root_motion_transform = Transform();
+	if (!p_deferred) {
+		root_motion_transform = Transform();
+	}
 
 	if (!root.is_valid()) {
 		ERR_PRINT("AnimationTree: root AnimationNode is not set, disabling playback.");
@@ -810,213 +823,195 @@ void AnimationTree::_process_graph(float p_delta) {
 	if (!state.valid) {
 		return; //state is not valid. do nothing.
 	}
-	//apply value/transform/bezier blends to track caches and execute method/audio/animation tracks
 
-	{
-		bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
+	_process_tracks();
 
+	if (p_deferred) {
+		// Blend weights live in the AnimationNodes, which other trees may share, so keep a
+		// copy of them until the deferred blend runs.
 		for (List<AnimationNode::AnimationState>::Element *E = state.animation_states.front(); E; E = E->next()) {
-			const AnimationNode::AnimationState &as = E->get();
+			blend_snapshots.push_back(*E->get().track_blends);
+			E->get().track_blends = &blend_snapshots.back()->get();
+		}
 
-			Ref<Animation> a = as.animation;
-			float time = as.time;
-			float delta = as.delta;
-			bool seeked = as.seeked;
+		if (!pending_blends.first()) {
+			_queue_pending_blends();
+		}
+		pending_blends.add(&pending_blend);
+		return;
+	}
 
-			for (int i = 0; i < a->get_track_count(); i++) {
-				NodePath path = a->track_get_path(i);
+	_blend_tracks();
+	_apply_tracks();
+}
 
-				ERR_CONTINUE(!track_cache.has(path));
+const Vector<AnimationTree::TrackBinding> &AnimationTree::_get_track_bindings(const Ref<Animation> &p_animation) {
+	ObjectID id = p_animation->get_instance_id();
+	int track_count = p_animation->get_track_count();
 
-				TrackCache *track = track_cache[path];
-				if (track->type != a->track_get_type(i)) {
-					continue; //may happen should not
-				}
+	Vector<TrackBinding> *bindings = track_bindings.getptr(id);
+	if (bindings && bindings->size() == track_count) {
+		return *bindings;
+	}
 
-				track->root_motion = root_motion_track == path;
+	Vector<TrackBinding> new_bindings;
+	new_bindings.resize(track_count);
+	TrackBinding *bindingsw = new_bindings.ptrw();
 
-				ERR_CONTINUE(!state.track_map.has(path));
-				int blend_idx = state.track_map[path];
+	for (int i = 0; i < track_count; i++) {
+		NodePath path = p_animation->track_get_path(i);
 
-				ERR_CONTINUE(blend_idx < 0 || blend_idx >= state.track_count);
+		bindingsw[i].cache = nullptr;
+		bindingsw[i].blend_idx = -1;
+		bindingsw[i].root_motion = root_motion_track == path;
 
-				float blend = (*as.track_blends)[blend_idx];
+		TrackCache **track = track_cache.getptr(path);
+		ERR_CONTINUE(!track);
 
-				if (blend < CMP_EPSILON) {
-					continue; //nothing to blend
-				}
+		if ((*track)->type != p_animation->track_get_type(i)) {
+			continue; //may happen should not
+		}
 
-				switch (track->type) {
-					case Animation::TYPE_TRANSFORM: {
-						TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
-
-						if (track->root_motion) {
-							if (t->process_pass != process_pass) {
-								t->process_pass = process_pass;
-								t->loc = Vector3();
-								t->rot = Quat();
-								t->rot_blend_accum = 0;
-								t->scale = Vector3(1, 1, 1);
-							}
+		const int *blend_idx = state.track_map.getptr(path);
+		ERR_CONTINUE(!blend_idx);
+		ERR_CONTINUE(*blend_idx < 0 || *blend_idx >= state.track_count);
 
-							float prev_time = time - delta;
-							if (prev_time < 0) {
-								if (!a->has_loop()) {
-									prev_time = 0;
-								} else {
-									prev_time = a->get_length() + prev_time;
-								}
-							}
+		bindingsw[i].cache = *track;
+		bindingsw[i].blend_idx = *blend_idx;
+	}
 
-							Vector3 loc[2];
-							Quat rot[2];
-							Vector3 scale[2];
+	track_bindings[id] = new_bindings;
+	return track_bindings[id];
+}
 
-							if (prev_time > time) {
-								Error err = a->transform_track_interpolate(i, prev_time, &loc[0], &rot[0], &scale[0]);
-								if (err != OK) {
-									continue;
-								}
+void AnimationTree::_process_tracks() {
+	//execute method/audio/animation tracks and discrete value keys, which have side effects and must run on the main thread
 
-								a->transform_track_interpolate(i, a->get_length(), &loc[1], &rot[1], &scale[1]);
+	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
 
-								t->loc += (loc[1] - loc[0]) * blend;
-								t->scale += (scale[1] - scale[0]) * blend;
-								Quat q = Quat().slerp(rot[0].normalized().inverse() * rot[1].normalized(), blend).normalized();
-								t->rot = (t->rot * q).normalized();
+	for (List<AnimationNode::AnimationState>::Element *E = state.animation_states.front(); E; E = E->next()) {
+		const AnimationNode::AnimationState &as = E->get();
 
-								prev_time = 0;
-							}
+		Ref<Animation> a = as.animation;
+		float time = as.time;
+		float delta = as.delta;
+		bool seeked = as.seeked;
 
-							Error err = a->transform_track_interpolate(i, prev_time, &loc[0], &rot[0], &scale[0]);
-							if (err != OK) {
-								continue;
-							}
+		const Vector<TrackBinding> &bindings = _get_track_bindings(a);
+		const float *track_blends = as.track_blends->ptr();
 
-							a->transform_track_interpolate(i, time, &loc[1], &rot[1], &scale[1]);
+		for (int i = 0; i < bindings.size(); i++) {
+			TrackCache *track = bindings[i].cache;
+			if (!track) {
+				continue;
+			}
 
-							t->loc += (loc[1] - loc[0]) * blend;
-							t->scale += (scale[1] - scale[0]) * blend;
-							Quat q = Quat().slerp(rot[0].normalized().inverse() * rot[1].normalized(), blend).normalized();
-							t->rot = (t->rot * q).normalized();
+			float blend = track_blends[bindings[i].blend_idx];
 
-							prev_time = 0;
+			if (blend < CMP_EPSILON) {
+				continue; //nothing to blend
+			}
 
-						} else {
-							Vector3 loc;
-							Quat rot;
-							Vector3 scale;
-
-							Error err = a->transform_track_interpolate(i, time, &loc, &rot, &scale);
-							//ERR_CONTINUE(err!=OK); //used for testing, should be removed
-
-							if (t->process_pass != process_pass) {
-								t->process_pass = process_pass;
-								t->loc = loc;
-								t->rot = rot;
-								t->rot_blend_accum = 0;
-								t->scale = scale;
-							}
+			switch (track->type) {
+				case Animation::TYPE_VALUE: {
+					if (delta == 0) {
+						continue;
+					}
 
-							if (err != OK) {
-								continue;
-							}
+					Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
 
-							t->loc = t->loc.lerp(loc, blend);
-							if (t->rot_blend_accum == 0) {
-								t->rot = rot;
-								t->rot_blend_accum = blend;
-							} else {
-								float rot_total = t->rot_blend_accum + blend;
-								t->rot = rot.slerp(t->rot, t->rot_blend_accum / rot_total).normalized();
-								t->rot_blend_accum = rot_total;
-							}
-							t->scale = t->scale.lerp(scale, blend);
-						}
+					if (update_mode == Animation::UPDATE_CONTINUOUS || update_mode == Animation::UPDATE_CAPTURE) {
+						continue; // Blended by _blend_tracks().
+					}
 
-					} break;
-					case Animation::TYPE_VALUE: {
-						TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
+					TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 
-						Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
+					List<int> indices;
+					a->value_track_get_key_indices(i, time, delta, &indices);
 
-						if (update_mode == Animation::UPDATE_CONTINUOUS || update_mode == Animation::UPDATE_CAPTURE) { //delta == 0 means seek
+					for (List<int>::Element *F = indices.front(); F; F = F->next()) {
+						Variant value = a->track_get_key_value(i, F->get());
+						t->object->set_indexed(t->subpath, value);
+					}
 
-							Variant value = a->value_track_interpolate(i, time);
+				} break;
+				case Animation::TYPE_METHOD: {
+					if (delta == 0) {
+						continue;
+					}
+					TrackCacheMethod *t = static_cast<TrackCacheMethod *>(track);
 
-							if (value == Variant()) {
-								continue;
-							}
+					List<int> indices;
 
-							if (t->process_pass != process_pass) {
-								t->value = value;
-								t->process_pass = process_pass;
-							}
+					a->method_track_get_key_indices(i, time, delta, &indices);
 
-							Variant::interpolate(t->value, value, blend, t->value);
+					for (List<int>::Element *F = indices.front(); F; F = F->next()) {
+						StringName method = a->method_track_get_name(i, F->get());
+						Vector<Variant> params = a->method_track_get_params(i, F->get());
 
-						} else if (delta != 0) {
-							List<int> indices;
-							a->value_track_get_key_indices(i, time, delta, &indices);
+						int s = params.size();
 
-							for (List<int>::Element *F = indices.front(); F; F = F->next()) {
-								Variant value = a->track_get_key_value(i, F->get());
-								t->object->set_indexed(t->subpath, value);
-							}
+						ERR_CONTINUE(s > VARIANT_ARG_MAX);
+						if (can_call) {
+							t->object->call_deferred(
+									method,
+									s >= 1 ? params[0] : Variant(),
+									s >= 2 ? params[1] : Variant(),
+									s >= 3 ? params[2] : Variant(),
+									s >= 4 ? params[3] : Variant(),
+									s >= 5 ? params[4] : Variant());
 						}
+					}
 
-					} break;
-					case Animation::TYPE_METHOD: {
-						if (delta == 0) {
+				} break;
+				case Animation::TYPE_AUDIO: {
+					TrackCacheAudio *t = static_cast<TrackCacheAudio *>(track);
+
+					if (seeked) {
+						//find whathever should be playing
+						int idx = a->track_find_key(i, time);
+						if (idx < 0) {
 							continue;
 						}
-						TrackCacheMethod *t = static_cast<TrackCacheMethod *>(track);
-
-						List<int> indices;
-
-						a->method_track_get_key_indices(i, time, delta, &indices);
-
-						for (List<int>::Element *F = indices.front(); F; F = F->next()) {
-							StringName method = a->method_track_get_name(i, F->get());
-							Vector<Variant> params = a->method_track_get_params(i, F->get());
 
-							int s = params.size();
+						Ref<AudioStream> stream = a->audio_track_get_key_stream(i, idx);
+						if (!stream.is_valid()) {
+							t->object->call("stop");
+							t->playing = false;
+							playing_caches.erase(t);
+						} else {
+							float start_ofs = a->audio_track_get_key_start_offset(i, idx);
+							start_ofs += time - a->track_get_key_time(i, idx);
+							float end_ofs = a->audio_track_get_key_end_offset(i, idx);
+							float len = stream->get_length();
 
-							ERR_CONTINUE(s > VARIANT_ARG_MAX);
-							if (can_call) {
-								t->object->call_deferred(
-										method,
-										s >= 1 ? params[0] : Variant(),
-										s >= 2 ? params[1] : Variant(),
-										s >= 3 ? params[2] : Variant(),
-										s >= 4 ? params[3] : Variant(),
-										s >= 5 ? params[4] : Variant());
+							if (start_ofs > len - end_ofs) {
+								t->object->call("stop");
+								t->playing = false;
+								playing_caches.erase(t);
+								continue;
 							}
-						}
 
-					} break;
-					case Animation::TYPE_BEZIER: {
-						TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
+							t->object->call("set_stream", stream);
+							t->object->call("play", start_ofs);
 
-						float bezier = a->bezier_track_interpolate(i, time);
+							t->playing = true;
+							playing_caches.insert(t);
+							if (len && end_ofs > 0) { //force a end at a time
+								t->len = len - start_ofs - end_ofs;
+							} else {
+								t->len = 0;
+							}
 
-						if (t->process_pass != process_pass) {
-							t->value = bezier;
-							t->process_pass = process_pass;
+							t->start = time;
 						}
 
-						t->value = Math::lerp(t->value, bezier, blend);
-
-					} break;
-					case Animation::TYPE_AUDIO: {
-						TrackCacheAudio *t = static_cast<TrackCacheAudio *>(track);
-
-						if (seeked) {
-							//find whathever should be playing
-							int idx = a->track_find_key(i, time);
-							if (idx < 0) {
-								continue;
-							}
+					} else {
+						//find stuff to play
+						List<int> to_play;
+						a->track_get_key_indices_in_range(i, time, delta, &to_play);
+						if (to_play.size()) {
+							int idx = to_play.back()->get();
 
 							Ref<AudioStream> stream = a->audio_track_get_key_stream(i, idx);
 							if (!stream.is_valid()) {
@@ -1025,17 +1020,9 @@ void AnimationTree::_process_graph(float p_delta) {
 								playing_caches.erase(t);
 							} else {
 								float start_ofs = a->audio_track_get_key_start_offset(i, idx);
-								start_ofs += time - a->track_get_key_time(i, idx);
 								float end_ofs = a->audio_track_get_key_end_offset(i, idx);
 								float len = stream->get_length();
 
-								if (start_ofs > len - end_ofs) {
-									t->object->call("stop");
-									t->playing = false;
-									playing_caches.erase(t);
-									continue;
-								}
-
 								t->object->call("set_stream", stream);
 								t->object->call("play", start_ofs);
 
@@ -1049,203 +1036,434 @@ void AnimationTree::_process_graph(float p_delta) {
 
 								t->start = time;
 							}
+						} else if (t->playing) {
+							bool loop = a->has_loop();
 
-						} else {
-							//find stuff to play
-							List<int> to_play;
-							a->track_get_key_indices_in_range(i, time, delta, &to_play);
-							if (to_play.size()) {
-								int idx = to_play.back()->get();
-
-								Ref<AudioStream> stream = a->audio_track_get_key_stream(i, idx);
-								if (!stream.is_valid()) {
-									t->object->call("stop");
-									t->playing = false;
-									playing_caches.erase(t);
-								} else {
-									float start_ofs = a->audio_track_get_key_start_offset(i, idx);
-									float end_ofs = a->audio_track_get_key_end_offset(i, idx);
-									float len = stream->get_length();
-
-									t->object->call("set_stream", stream);
-									t->object->call("play", start_ofs);
-
-									t->playing = true;
-									playing_caches.insert(t);
-									if (len && end_ofs > 0) { //force a end at a time
-										t->len = len - start_ofs - end_ofs;
-									} else {
-										t->len = 0;
-									}
-
-									t->start = time;
-								}
-							} else if (t->playing) {
-								bool loop = a->has_loop();
+							bool stop = false;
 
-								bool stop = false;
+							if (!loop && time < t->start) {
+								stop = true;
+							} else if (t->len > 0) {
+								float len = t->start > time ? (a->get_length() - t->start) + time : time - t->start;
 
-								if (!loop && time < t->start) {
+								if (len > t->len) {
 									stop = true;
-								} else if (t->len > 0) {
-									float len = t->start > time ? (a->get_length() - t->start) + time : time - t->start;
-
-									if (len > t->len) {
-										stop = true;
-									}
 								}
+							}
 
-								if (stop) {
-									//time to stop
-									t->object->call("stop");
-									t->playing = false;
-									playing_caches.erase(t);
-								}
+							if (stop) {
+								//time to stop
+								t->object->call("stop");
+								t->playing = false;
+								playing_caches.erase(t);
 							}
 						}
+					}
 
-						float db = Math::linear2db(MAX(blend, 0.00001));
-						if (t->object->has_method("set_unit_db")) {
-							t->object->call("set_unit_db", db);
-						} else {
-							t->object->call("set_volume_db", db);
-						}
-					} break;
-					case Animation::TYPE_ANIMATION: {
-						TrackCacheAnimation *t = static_cast<TrackCacheAnimation *>(track);
+					float db = Math::linear2db(MAX(blend, 0.00001));
+					if (t->object->has_method("set_unit_db")) {
+						t->object->call("set_unit_db", db);
+					} else {
+						t->object->call("set_volume_db", db);
+					}
+				} break;
+				case Animation::TYPE_ANIMATION: {
+					TrackCacheAnimation *t = static_cast<TrackCacheAnimation *>(track);
 
-						AnimationPlayer *player2 = Object::cast_to<AnimationPlayer>(t->object);
+					AnimationPlayer *player2 = Object::cast_to<AnimationPlayer>(t->object);
 
-						if (!player2) {
+					if (!player2) {
+						continue;
+					}
+
+					if (delta == 0 || seeked) {
+						//seek
+						int idx = a->track_find_key(i, time);
+						if (idx < 0) {
 							continue;
 						}
 
-						if (delta == 0 || seeked) {
-							//seek
-							int idx = a->track_find_key(i, time);
-							if (idx < 0) {
-								continue;
-							}
+						float pos = a->track_get_key_time(i, idx);
 
-							float pos = a->track_get_key_time(i, idx);
+						StringName anim_name = a->animation_track_get_key_animation(i, idx);
+						if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
+							continue;
+						}
 
-							StringName anim_name = a->animation_track_get_key_animation(i, idx);
-							if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
-								continue;
-							}
+						Ref<Animation> anim = player2->get_animation(anim_name);
 
-							Ref<Animation> anim = player2->get_animation(anim_name);
+						float at_anim_pos;
 
-							float at_anim_pos;
+						if (anim->has_loop()) {
+							at_anim_pos = Math::fposmod(time - pos, anim->get_length()); //seek to loop
+						} else {
+							at_anim_pos = MAX(anim->get_length(), time - pos); //seek to end
+						}
 
-							if (anim->has_loop()) {
-								at_anim_pos = Math::fposmod(time - pos, anim->get_length()); //seek to loop
-							} else {
-								at_anim_pos = MAX(anim->get_length(), time - pos); //seek to end
-							}
+						if (player2->is_playing() || seeked) {
+							player2->play(anim_name);
+							player2->seek(at_anim_pos);
+							t->playing = true;
+							playing_caches.insert(t);
+						} else {
+							player2->set_assigned_animation(anim_name);
+							player2->seek(at_anim_pos, true);
+						}
+					} else {
+						//find stuff to play
+						List<int> to_play;
+						a->track_get_key_indices_in_range(i, time, delta, &to_play);
+						if (to_play.size()) {
+							int idx = to_play.back()->get();
 
-							if (player2->is_playing() || seeked) {
+							StringName anim_name = a->animation_track_get_key_animation(i, idx);
+							if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
+								if (playing_caches.has(t)) {
+									playing_caches.erase(t);
+									player2->stop();
+									t->playing = false;
+								}
+							} else {
 								player2->play(anim_name);
-								player2->seek(at_anim_pos);
 								t->playing = true;
 								playing_caches.insert(t);
-							} else {
-								player2->set_assigned_animation(anim_name);
-								player2->seek(at_anim_pos, true);
-							}
-						} else {
-							//find stuff to play
-							List<int> to_play;
-							a->track_get_key_indices_in_range(i, time, delta, &to_play);
-							if (to_play.size()) {
-								int idx = to_play.back()->get();
-
-								StringName anim_name = a->animation_track_get_key_animation(i, idx);
-								if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
-									if (playing_caches.has(t)) {
-										playing_caches.erase(t);
-										player2->stop();
-										t->playing = false;
-									}
-								} else {
-									player2->play(anim_name);
-									t->playing = true;
-									playing_caches.insert(t);
-								}
 							}
 						}
+					}
 
-					} break;
-				}
+				} break;
+				default: {
+				} // Blended or applied elsewhere.
 			}
 		}
 	}
+}
 
-	{
-		// finally, set the tracks
-		const NodePath *K = nullptr;
-		while ((K = track_cache.next(K))) {
-			TrackCache *track = track_cache[*K];
-			if (track->process_pass != process_pass) {
-				continue; //not processed, ignore
+void AnimationTree::_blend_tracks() {
+	//blend value/transform/bezier tracks into the track caches; only touches this tree's own caches, so it may run on a worker thread
+
+	for (List<AnimationNode::AnimationState>::Element *E = state.animation_states.front(); E; E = E->next()) {
+		const AnimationNode::AnimationState &as = E->get();
+
+		const Ref<Animation> &a = as.animation;
+		float time = as.time;
+		float delta = as.delta;
+
+		const Vector<TrackBinding> *bindings = track_bindings.getptr(a->get_instance_id());
+		ERR_CONTINUE(!bindings); // Created by _process_tracks().
+		const TrackBinding *bindingsptr = bindings->ptr();
+		const float *track_blends = as.track_blends->ptr();
+
+		for (int i = 0; i < bindings->size(); i++) {
+			TrackCache *track = bindingsptr[i].cache;
+			if (!track) {
+				continue;
+			}
+
+			track->root_motion = bindingsptr[i].root_motion;
+
+			float blend = track_blends[bindingsptr[i].blend_idx];
+
+			if (blend < CMP_EPSILON) {
+				continue; //nothing to blend
 			}
 
 			switch (track->type) {
 				case Animation::TYPE_TRANSFORM: {
 					TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
 
-					Transform xform;
-					xform.origin = t->loc;
+					if (track->root_motion) {
+						if (t->process_pass != process_pass) {
+							t->process_pass = process_pass;
+							t->loc = Vector3();
+							t->rot = Quat();
+							t->rot_blend_accum = 0;
+							t->scale = Vector3(1, 1, 1);
+						}
 
-					xform.basis.set_quat_scale(t->rot, t->scale);
+						float prev_time = time - delta;
+						if (prev_time < 0) {
+							if (!a->has_loop()) {
+								prev_time = 0;
+							} else {
+								prev_time = a->get_length() + prev_time;
+							}
+						}
+
+						Vector3 loc[2];
+						Quat rot[2];
+						Vector3 scale[2];
+
+						if (prev_time > time) {
+							Error err = a->transform_track_interpolate(i, prev_time, &loc[0], &rot[0], &scale[0]);
+							if (err != OK) {
+								continue;
+							}
+
+							a->transform_track_interpolate(i, a->get_length(), &loc[1], &rot[1], &scale[1]);
 
-					if (t->root_motion) {
-						root_motion_transform = xform;
+							t->loc += (loc[1] - loc[0]) * blend;
+							t->scale += (scale[1] - scale[0]) * blend;
+							Quat q = Quat().slerp(rot[0].normalized().inverse() * rot[1].normalized(), blend).normalized();
+							t->rot = (t->rot * q).normalized();
 
-						if (t->skeleton && t->bone_idx >= 0) {
-							root_motion_transform = (t->skeleton->get_bone_rest(t->bone_idx) * root_motion_transform) * t->skeleton->get_bone_rest(t->bone_idx).affine_inverse();
+							prev_time = 0;
 						}
-					} else if (t->skeleton && t->bone_idx >= 0) {
-						t->skeleton->set_bone_pose(t->bone_idx, xform);
+
+						Error err = a->transform_track_interpolate(i, prev_time, &loc[0], &rot[0], &scale[0]);
+						if (err != OK) {
+							continue;
+						}
+
+						a->transform_track_interpolate(i, time, &loc[1], &rot[1], &scale[1]);
+
+						t->loc += (loc[1] - loc[0]) * blend;
+						t->scale += (scale[1] - scale[0]) * blend;
+						Quat q = Quat().slerp(rot[0].normalized().inverse() * rot[1].normalized(), blend).normalized();
+						t->rot = (t->rot * q).normalized();
+
+						prev_time = 0;
 
 					} else {
-						t->spatial->set_transform(xform);
+						Vector3 loc;
+						Quat rot;
+						Vector3 scale;
+
+						Error err = a->transform_track_interpolate(i, time, &loc, &rot, &scale);
+						//ERR_CONTINUE(err!=OK); //used for testing, should be removed
+
+						if (t->process_pass != process_pass) {
+							t->process_pass = process_pass;
+							t->loc = loc;
+							t->rot = rot;
+							t->rot_blend_accum = 0;
+							t->scale = scale;
+						}
+
+						if (err != OK) {
+							continue;
+						}
+
+						t->loc = t->loc.lerp(loc, blend);
+						if (t->rot_blend_accum == 0) {
+							t->rot = rot;
+							t->rot_blend_accum = blend;
+						} else {
+							float rot_total = t->rot_blend_accum + blend;
+							t->rot = rot.slerp(t->rot, t->rot_blend_accum / rot_total).normalized();
+							t->rot_blend_accum = rot_total;
+						}
+						t->scale = t->scale.lerp(scale, blend);
 					}
 
 				} break;
 				case Animation::TYPE_VALUE: {
 					TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 
-					t->object->set_indexed(t->subpath, t->value);
+					Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
+
+					if (update_mode != Animation::UPDATE_CONTINUOUS && update_mode != Animation::UPDATE_CAPTURE) {
+						continue; // Discrete keys are handled by _process_tracks().
+					}
+
+					if (lod_reduce_tracks && update_mode == Animation::UPDATE_CONTINUOUS) {
+						continue; // skipped at low levels of detail
+					}
+
+					Variant value = a->value_track_interpolate(i, time);
+
+					if (value == Variant()) {
+						continue;
+					}
+
+					if (t->process_pass != process_pass) {
+						t->value = value;
+						t->process_pass = process_pass;
+					}
+
+					Variant::interpolate(t->value, value, blend, t->value);
 
 				} break;
 				case Animation::TYPE_BEZIER: {
+					if (lod_reduce_tracks) {
+						continue; // skipped at low levels of detail
+					}
+
 					TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
 
-					t->object->set_indexed(t->subpath, t->value);
+					float bezier = a->bezier_track_interpolate(i, time);
+
+					if (t->process_pass != process_pass) {
+						t->value = bezier;
+						t->process_pass = process_pass;
+					}
+
+					t->value = Math::lerp(t->value, bezier, blend);
 
 				} break;
 				default: {
-				} //the rest don't matter
+				} // Blended or applied elsewhere.
 			}
 		}
 	}
 }
 
+void AnimationTree::_apply_tracks() {
+	// finally, set the tracks
+
+	root_motion_transform = Transform();
+
+	for (uint32_t i = 0; i < track_list.size(); i++) {
+		TrackCache *track = track_list[i];
+		if (track->process_pass != process_pass) {
+			continue; //not processed, ignore
+		}
+
+		switch (track->type) {
+			case Animation::TYPE_TRANSFORM: {
+				TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+
+				Transform xform;
+				xform.origin = t->loc;
+
+				xform.basis.set_quat_scale(t->rot, t->scale);
+
+				if (t->root_motion) {
+					root_motion_transform = xform;
+
+					if (t->skeleton && t->bone_idx >= 0) {
+						root_motion_transform = (t->skeleton->get_bone_rest(t->bone_idx) * root_motion_transform) * t->skeleton->get_bone_rest(t->bone_idx).affine_inverse();
+					}
+				} else if (t->skeleton && t->bone_idx >= 0) {
+					t->skeleton->set_bone_pose(t->bone_idx, xform);
+
+				} else {
+					t->spatial->set_transform(xform);
+				}
+
+			} break;
+			case Animation::TYPE_VALUE: {
+				TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
+
+				t->object->set_indexed(t->subpath, t->value);
+
+			} break;
+			case Animation::TYPE_BEZIER: {
+				TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
+
+				t->object->set_indexed(t->subpath, t->value);
+
+			} break;
+			default: {
+			} //the rest don't matter
+		}
+	}
+}
+
+SelfList<AnimationTree>::List AnimationTree::pending_blends;
+ObjectID AnimationTree::pending_blends_owner;
+
+void AnimationTree::BlendJob::blend(uint32_t p_index, AnimationTree **p_trees) {
+	p_trees[p_index]->_blend_tracks();
+}
+
+void AnimationTree::_queue_pending_blends() {
+	// Queued by ObjectID, so freeing this tree before the flush drops the notification instead of calling into freed memory.
+	pending_blends_owner = get_instance_id();
+	MessageQueue::get_singleton()->push_notification(this, NOTIFICATION_PROCESS_PENDING_BLENDS);
+}
+
+void AnimationTree::_process_pending_blends() {
+	pending_blends_owner = ObjectID();
+
+	LocalVector<AnimationTree *> trees;
+	while (pending_blends.first()) {
+		AnimationTree *tree = pending_blends.first()->self();
+		pending_blends.remove(pending_blends.first());
+		trees.push_back(tree);
+	}
+
+	uint32_t count = trees.size();
+	if (count == 0) {
+		return; // Already processed together with other trees.
+	}
+
+	ThreadWorkPool *pool = SceneTree::get_singleton() ? SceneTree::get_singleton()->get_thread_work_pool() : nullptr;
+
+	if (pool && count >= PARALLEL_BLEND_MIN_TREES) {
+		BlendJob job;
+		pool->do_work(count, &job, &BlendJob::blend, &trees[0]);
+	} else {
+		for (uint32_t i = 0; i < count; i++) {
+			trees[i]->_blend_tracks();
+		}
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		trees[i]->_apply_tracks();
+		trees[i]->blend_snapshots.clear();
+	}
+}
+
+void AnimationTree::_cancel_pending_blend() {
+	if (!pending_blend.in_list()) {
+		return;
+	}
+
+	pending_blends.remove(&pending_blend);
+	state.animation_states.clear();
+	blend_snapshots.clear();
+
+	if (pending_blends_owner == get_instance_id() && pending_blends.first()) {
+		// This tree may be about to be freed, let one of the remaining trees flush instead.
+		pending_blends.first()->self()->_queue_pending_blends();
+	}
+}
+
 void AnimationTree::advance(float p_time) {
 	_process_graph(p_time);
 }
 
+bool AnimationTree::_lod_should_process(float p_delta, float &r_delta) {
+	if (lod.is_null() || started) {
+		r_delta = p_delta + lod_state.delta_accum;
+		lod_state.reset();
+		lod_reduce_tracks = false;
+		return true;
+	}
+
+	Node *target = nullptr;
+	AnimationPlayer *player = Object::cast_to<AnimationPlayer>(get_node_or_null(animation_player));
+	if (player && player->has_node(player->get_root())) {
+		target = player->get_node(player->get_root());
+	}
+	Node *notifier = lod_visibility_notifier.is_empty() ? nullptr : get_node_or_null(lod_visibility_notifier);
+	uint64_t frame = process_mode == ANIMATION_PROCESS_PHYSICS ? Engine::get_singleton()->get_physics_frames() : Engine::get_singleton()->get_idle_frames();
+
+	if (!lod_state.process(lod.ptr(), target, notifier, frame, uint32_t(uint64_t(get_instance_id())), p_delta, r_delta)) {
+		return false;
+	}
+
+	lod_reduce_tracks = lod_state.reduced_tracks;
+	return true;
+}
+
 void AnimationTree::_notification(int p_what) {
-	if (active && p_what == NOTIFICATION_INTERNAL_PHYSICS_PROCESS && process_mode == ANIMATION_PROCESS_PHYSICS) {
-		_process_graph(get_physics_process_delta_time());
+	float delta;
+
+	if (active && p_what == NOTIFICATION_INTERNAL_PHYSICS_PROCESS && process_mode == ANIMATION_PROCESS_PHYSICS && _lod_should_process(get_physics_process_delta_time(), delta)) {
+		_process_graph(delta, parallel_blending);
 	}
 
-	if (active && p_what == NOTIFICATION_INTERNAL_PROCESS && process_mode == ANIMATION_PROCESS_IDLE) {
-		_process_graph(get_process_delta_time());
+	if (active && p_what == NOTIFICATION_INTERNAL_PROCESS && process_mode == ANIMATION_PROCESS_IDLE && _lod_should_process(get_process_delta_time(), delta)) {
+		_process_graph(delta, parallel_blending);
 	}
 
-	if (p_what == NOTIFICATION_EXIT_TREE) {
+	if (p_what == NOTIFICATION_PROCESS_PENDING_BLENDS) {
+		if (pending_blends_owner == get_instance_id()) {
+			_process_pending_blends();
+		}
+	} else if (p_what == NOTIFICATION_EXIT_TREE) {
 		_clear_caches();
 		if (last_animation_player.is_valid()) {
 			Object *player = ObjectDB::get_instance(last_animation_player);
@@ -1263,6 +1481,36 @@ void AnimationTree::_notification(int p_what) {
 	}
 }
 
+void AnimationTree::set_parallel_blending_enabled(bool p_enabled) {
+	parallel_blending = p_enabled;
+}
+
+bool AnimationTree::is_parallel_blending_enabled() const {
+	return parallel_blending;
+}
+
+void AnimationTree::set_lod_settings(const Ref<AnimationLOD> &p_lod) {
+	lod = p_lod;
+	lod_state.reset();
+	lod_reduce_tracks = false;
+}
+
+Ref<AnimationLOD> AnimationTree::get_lod_settings() const {
+	return lod;
+}
+
+void AnimationTree::set_lod_visibility_notifier(const NodePath &p_path) {
+	lod_visibility_notifier = p_path;
+}
+
+NodePath AnimationTree::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
+int AnimationTree::get_lod_level() const {
+	return lod.is_valid() ? lod_state.level : 0;
+}
+
 void AnimationTree::set_animation_player(const NodePath &p_player) {
 	animation_player = p_player;
 	update_configuration_warning();
@@ -1328,6 +1576,9 @@ String AnimationTree::get_configuration_warning() const {
 
 void AnimationTree::set_root_motion_track(const NodePath &p_track) {
 	root_motion_track = p_track;
+
+	_cancel_pending_blend();
+	track_bindings.clear(); // Bindings cache the root motion flag.
 }
 
 NodePath AnimationTree::get_root_motion_track() const {
@@ -1488,6 +1739,16 @@ void AnimationTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_mode", "mode"), &AnimationTree::set_process_mode);
 	ClassDB::bind_method(D_METHOD("get_process_mode"), &AnimationTree::get_process_mode);
 
+	ClassDB::bind_method(D_METHOD("set_parallel_blending_enabled", "enabled"), &AnimationTree::set_parallel_blending_enabled);
+	ClassDB::bind_method(D_METHOD("is_parallel_blending_enabled"), &AnimationTree::is_parallel_blending_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_lod_settings", "settings"), &AnimationTree::set_lod_settings);
+	ClassDB::bind_method(D_METHOD("get_lod_settings"), &AnimationTree::get_lod_settings);
+
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "path"), &AnimationTree::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationTree::get_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_level"), &AnimationTree::get_lod_level);
+
 	ClassDB::bind_method(D_METHOD("set_animation_player", "root"), &AnimationTree::set_animation_player);
 	ClassDB::bind_method(D_METHOD("get_animation_player"), &AnimationTree::get_animation_player);
 
@@ -1506,15 +1767,20 @@ void AnimationTree::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "anim_player", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "AnimationPlayer"), "set_animation_player", "get_animation_player");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_process_mode", "get_process_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "parallel_blending"), "set_parallel_blending_enabled", "is_parallel_blending_enabled");
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
+	ADD_GROUP("Level of Detail", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "lod_settings", PROPERTY_HINT_RESOURCE_TYPE, "AnimationLOD"), "set_lod_settings", "get_lod_settings");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "VisibilityNotifier3D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
 
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_PHYSICS);
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_MANUAL);
 }
 
-AnimationTree::AnimationTree() {
+AnimationTree::AnimationTree() :
+		pending_blend(this) {
 	process_mode = ANIMATION_PROCESS_IDLE;
 	active = false;
 	cache_valid = false;
@@ -1525,4 +1791,5 @@ AnimationTree::AnimationTree() {
 }
 
 AnimationTree::~AnimationTree() {
+	_cancel_pending_blend();
 }
@@ -32,6 +32,8 @@
 #define ANIMATION_GRAPH_PLAYER_H
 
 #include "animation_player.h"
+#include "core/local_vector.h"
+#include "core/self_list.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/resources/animation.h"
@@ -248,6 +250,19 @@ private:
 	HashMap<NodePath, TrackCache *> track_cache;
 	Set<TrackCache *> playing_caches;
 
+	// Track caches resolved per animation track, so playback does not look up
+	// NodePaths every frame. Rebuilt when the caches are.
+	struct TrackBinding {
+		TrackCache *cache;
+		int blend_idx;
+		bool root_motion;
+	};
+
+	HashMap<ObjectID, Vector<TrackBinding>> track_bindings;
+	LocalVector<TrackCache *> track_list; // Indexed by blend index.
+
+	const Vector<TrackBinding> &_get_track_bindings(const Ref<Animation> &p_animation);
+
 	Ref<AnimationNode> root;
 
 	AnimationProcessMode process_mode;
@@ -261,7 +276,37 @@ private:
 
 	void _clear_caches();
 	bool _update_caches(AnimationPlayer *player);
-	void _process_graph(float p_delta);
+	void _process_graph(float p_delta, bool p_deferred = false);
+	void _process_tracks();
+	void _blend_tracks();
+	void _apply_tracks();
+
+	// With parallel blending, the blend step of all trees processed in a frame
+	// runs in one batch at the next message queue flush, spread across threads.
+	enum {
+		PARALLEL_BLEND_MIN_TREES = 4
+	};
+
+	bool parallel_blending = false;
+
+	Ref<AnimationLOD> lod;
+	NodePath lod_visibility_notifier;
+	AnimationLODState lod_state;
+	bool lod_reduce_tracks = false;
+
+	bool _lod_should_process(float p_delta, float &r_delta);
+	SelfList<AnimationTree> pending_blend;
+	static SelfList<AnimationTree>::List pending_blends;
+	static ObjectID pending_blends_owner; // The tree whose queued notification flushes all pending blends.
+	List<Vector<float>> blend_snapshots;
+
+	struct BlendJob {
+		void blend(uint32_t p_index, AnimationTree **p_trees);
+	};
+
+	void _queue_pending_blends();
+	void _process_pending_blends();
+	void _cancel_pending_blend();
 
 	uint64_t setup_pass;
 	uint64_t process_pass;
@@ -300,6 +345,10 @@ protected:
 	static void _bind_methods();
 
 public:
+	enum {
+		NOTIFICATION_PROCESS_PENDING_BLENDS = 50
+	};
+
 	void set_tree_root(const Ref<AnimationNode> &p_root);
 	Ref<AnimationNode> get_tree_root() const;
 
@@ -309,6 +358,16 @@ public:
 	void set_process_mode(AnimationProcessMode p_mode);
 	AnimationProcessMode get_process_mode() const;
 
+	void set_parallel_blending_enabled(bool p_enabled);
+	bool is_parallel_blending_enabled() const;
+
+	void set_lod_settings(const Ref<AnimationLOD> &p_lod);
+	Ref<AnimationLOD> get_lod_settings() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_path);
+	NodePath get_lod_visibility_notifier() const;
+	int get_lod_level() const;
+
 	void set_animation_player(const NodePath &p_player);
 	NodePath get_animation_player() const;
 
@@ -282,9 +282,7 @@ void Node::_propagate_exit_tree() {
 
 	data.viewport = nullptr;
 
-	if (data.tree) {
-		data.tree->tree_changed();
-	}
+	// _set_tree() reports the change once for the whole subtree.
 
 	data.inside_tree = false;
 	data.ready_notified = false;
@@ -297,6 +295,7 @@ void Node::move_child(Node *p_child, int p_pos) {
 	ERR_FAIL_INDEX_MSG(p_pos, data.children.size() + 1, "Invalid new child position: " + itos(p_pos) + ".");
 	ERR_FAIL_COND_MSG(p_child->data.parent != this, "Child is not a child of this node.");
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, move_child() failed. Consider using call_deferred(\"move_child\") instead (or \"popup\" if this is from a popup).");
+	ERR_FAIL_COND_MSG(data.tree && data.tree->_is_threaded_process_caller(), "Can't move children while processing in a sub thread, move_child() failed. Consider using call_deferred(\"move_child\") instead.");
 
 	// Specifying one place beyond the end
 	// means the same as moving to the last position
@@ -922,6 +921,14 @@ int Node::get_process_priority() const {
 	return data.process_priority;
 }
 
+void Node::set_process_thread_group(ProcessThreadGroup p_group) {
+	data.process_thread_group = p_group;
+}
+
+Node::ProcessThreadGroup Node::get_process_thread_group() const {
+	return data.process_thread_group;
+}
+
 void Node::set_process_input(bool p_enable) {
 	if (p_enable == data.input) {
 		return;
@@ -988,7 +995,13 @@ StringName Node::get_name() const {
 }
 
 void Node::_set_name_nocheck(const StringName &p_name) {
+	StringName old_name = data.name;
 	data.name = p_name;
+
+	if (data.parent) {
+		data.parent->_unindex_child_name(this, old_name);
+		data.parent->_index_child_name(this);
+	}
 }
 
 String Node::invalid_character = ". : @ / \"";
@@ -1009,10 +1022,13 @@ void Node::set_name(const String &p_name) {
 	_validate_node_name(name);
 
 	ERR_FAIL_COND(name == "");
+	StringName old_name = data.name;
 	data.name = name;
 
 	if (data.parent) {
 		data.parent->_validate_child_name(this);
+		data.parent->_unindex_child_name(this, old_name);
+		data.parent->_index_child_name(this);
 	}
 
 	propagate_notification(NOTIFICATION_PATH_CHANGED);
@@ -1065,18 +1081,7 @@ void Node::_validate_child_name(Node *p_child, bool p_force_human_readable) {
 			unique = false;
 		} else {
 			//check if exists
-			Node **children = data.children.ptrw();
-			int cc = data.children.size();
-
-			for (int i = 0; i < cc; i++) {
-				if (children[i] == p_child) {
-					continue;
-				}
-				if (children[i]->data.name == p_child->data.name) {
-					unique = false;
-					break;
-				}
-			}
+			unique = !_has_child_named(p_child->data.name, p_child);
 		}
 
 		if (!unique) {
@@ -1133,24 +1138,8 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 	}
 
 	//quickly test if proposed name exists
-	int cc = data.children.size(); //children count
-	const Node *const *children_ptr = data.children.ptr();
-
-	{
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) { //exclude self in renaming if its already a child
-				continue;
-			}
-			if (children_ptr[i]->data.name == name) {
-				exists = true;
-			}
-		}
-
-		if (!exists) {
-			return; //if it does not exist, it does not need validation
-		}
+	if (!_has_child_named(name, p_child)) { //exclude self in renaming if its already a child
+		return; //if it does not exist, it does not need validation
 	}
 
 	// Extract trailing number
@@ -1175,21 +1164,17 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		nums = "";
 	}
 
+	// Whether all numbers below the current attempt are known to be taken.
+	bool serial_known = nums.length() == 0 || nums == "2";
+
 	for (;;) {
 		StringName attempt = name_string + nums;
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) {
-				continue;
-			}
-			if (children_ptr[i]->data.name == attempt) {
-				exists = true;
-			}
-		}
 
-		if (!exists) {
+		if (!_has_child_named(attempt, p_child)) {
 			name = attempt;
+			if (serial_known && nums.length() > 0) {
+				data.child_name_serials[name_string] = nums.to_int();
+			}
 			return;
 		} else {
 			if (nums.length() == 0) {
@@ -1199,6 +1184,13 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 			} else {
 				nums = increase_numeric_string(nums);
 			}
+
+			// Numbers up to the last one given to this base name are taken, unless a child was removed or renamed since.
+			const int *last = data.child_name_serials.getptr(name_string);
+			if (last && *last >= nums.to_int() && nums[0] != '0') {
+				nums = itos(*last + 1);
+				serial_known = true;
+			}
 		}
 	}
 }
@@ -1209,6 +1201,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 	p_child->data.name = p_name;
 	p_child->data.pos = data.children.size();
 	data.children.push_back(p_child);
+	_index_child_name(p_child);
 	p_child->data.parent = this;
 	p_child->notification(NOTIFICATION_PARENTED);
 
@@ -1227,6 +1220,7 @@ void Node::add_child(Node *p_child, bool p_legible_unique_name) {
 	ERR_FAIL_COND_MSG(p_child == this, "Can't add child '" + p_child->get_name() + "' to itself."); // adding to itself!
 	ERR_FAIL_COND_MSG(p_child->data.parent, "Can't add child '" + p_child->get_name() + "' to '" + get_name() + "', already has a parent '" + p_child->data.parent->get_name() + "'."); //Fail if node has a parent
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, add_node() failed. Consider using call_deferred(\"add_child\", child) instead.");
+	ERR_FAIL_COND_MSG(data.tree && data.tree->_is_threaded_process_caller(), "Can't add children while processing in a sub thread, add_child() failed. Consider using call_deferred(\"add_child\", child) instead.");
 
 	/* Validate name */
 	_validate_child_name(p_child, p_legible_unique_name);
@@ -1275,6 +1269,7 @@ void Node::_propagate_validate_owner() {
 void Node::remove_child(Node *p_child) {
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, remove_node() failed. Consider using call_deferred(\"remove_child\", child) instead.");
+	ERR_FAIL_COND_MSG(data.tree && data.tree->_is_threaded_process_caller(), "Can't remove children while processing in a sub thread, remove_child() failed. Consider using call_deferred(\"remove_child\", child) instead.");
 
 	int child_count = data.children.size();
 	Node **children = data.children.ptrw();
@@ -1307,6 +1302,7 @@ void Node::remove_child(Node *p_child) {
 	p_child->notification(NOTIFICATION_UNPARENTED);
 
 	data.children.remove(idx);
+	_unindex_child_name(p_child, p_child->data.name);
 
 	//update pointer and size
 	child_count = data.children.size();
@@ -1339,6 +1335,11 @@ Node *Node::get_child(int p_index) const {
 }
 
 Node *Node::_get_child_by_name(const StringName &p_name) const {
+	if (data.children_indexed) {
+		Node *const *child = data.children_by_name.getptr(p_name);
+		return child ? *child : nullptr;
+	}
+
 	int cc = data.children.size();
 	Node *const *cd = data.children.ptr();
 
@@ -1351,13 +1352,72 @@ Node *Node::_get_child_by_name(const StringName &p_name) const {
 	return nullptr;
 }
 
-Node *Node::get_node_or_null(const NodePath &p_path) const {
-	if (p_path.is_empty()) {
-		return nullptr;
+bool Node::_has_child_named(const StringName &p_name, const Node *p_exclude) const {
+	if (data.children_indexed) {
+		Node *const *child = data.children_by_name.getptr(p_name);
+		return child && *child != p_exclude;
 	}
 
-	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
+	int cc = data.children.size();
+	Node *const *cd = data.children.ptr();
 
+	for (int i = 0; i < cc; i++) {
+		if (cd[i] != p_exclude && cd[i]->data.name == p_name) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Node::_index_child_name(Node *p_child) {
+	if (data.children_indexed) {
+		if (!data.children_by_name.has(p_child->data.name)) {
+			data.children_by_name[p_child->data.name] = p_child;
+		}
+		return;
+	}
+
+	if (data.children.size() < CHILD_NAME_INDEX_MIN_CHILDREN) {
+		return;
+	}
+
+	// Fill in reverse, so the first child wins if a name is duplicated, like in the linear search.
+	for (int i = data.children.size() - 1; i >= 0; i--) {
+		data.children_by_name[data.children[i]->data.name] = data.children[i];
+	}
+	data.children_indexed = true;
+}
+
+void Node::_unindex_child_name(Node *p_child, const StringName &p_name) {
+	// The name may be handed out again.
+	data.child_name_serials.clear();
+
+	if (!data.children_indexed) {
+		return;
+	}
+
+	if (data.children.size() < CHILD_NAME_INDEX_MIN_CHILDREN / 2) {
+		data.children_by_name.clear();
+		data.children_indexed = false;
+		return;
+	}
+
+	Node **child = data.children_by_name.getptr(p_name);
+	if (child && *child == p_child) {
+		data.children_by_name.erase(p_name);
+
+		// Another child may still carry the name (e.g. added without validation), it takes over.
+		for (int i = 0; i < data.children.size(); i++) {
+			if (data.children[i] != p_child && data.children[i]->data.name == p_name) {
+				data.children_by_name[p_name] = data.children[i];
+				break;
+			}
+		}
+	}
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1391,16 +1451,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 		} else {
-			next = nullptr;
-
-			for (int j = 0; j < current->data.children.size(); j++) {
-				Node *child = current->data.children[j];
-
-				if (child->data.name == name) {
-					next = child;
-					break;
-				}
-			}
+			next = current->_get_child_by_name(name);
 			if (next == nullptr) {
 				return nullptr;
 			};
@@ -1411,6 +1462,71 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 	return current;
 }
 
+bool Node::_is_node_at_path(const Node *p_node, const NodePath &p_path) const {
+	// Names are unique among siblings, so a node whose ancestors carry the
+	// path's names (and end at this node, or the root) is what it resolves to.
+	const Node *current = p_node;
+	for (int i = p_path.get_name_count() - 1; i >= 0; i--) {
+		if (!current || current->data.name != p_path.get_name(i)) {
+			return false;
+		}
+		current = current->data.parent;
+	}
+
+	if (p_path.is_absolute()) {
+		return current == nullptr && p_node->is_inside_tree() && p_node->data.tree == data.tree;
+	}
+	return current == this;
+}
+
+Node *Node::get_node_or_null(const NodePath &p_path) const {
+	if (p_path.is_empty()) {
+		return nullptr;
+	}
+
+	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
+
+	if (p_path.get_name_count() < 2 && !p_path.is_absolute()) {
+		return _resolve_node_path(p_path); // Single names are a direct child lookup already.
+	}
+
+	if (data.node_path_cache) {
+		const ObjectID *cached = data.node_path_cache->getptr(p_path);
+		if (cached) {
+			// The cached node may have been freed, moved or renamed since.
+			Node *node = Object::cast_to<Node>(ObjectDB::get_instance(*cached));
+			if (node && _is_node_at_path(node, p_path)) {
+				return node;
+			}
+		}
+	}
+
+	Node *node = _resolve_node_path(p_path);
+	if (!node) {
+		return nullptr; // Misses can't be validated, they are not cached.
+	}
+
+	for (int i = 0; i < p_path.get_name_count(); i++) {
+		StringName name = p_path.get_name(i);
+		if (name == SceneStringNames::get_singleton()->dot || name == SceneStringNames::get_singleton()->doubledot) {
+			return node; // Only plain names can be checked by walking up from the node.
+		}
+	}
+
+	// Several sub threads may look up paths from the same node, so they only read the cache.
+	if (!(data.tree && data.tree->threaded_processing)) {
+		if (!data.node_path_cache) {
+			data.node_path_cache = memnew((HashMap<NodePath, ObjectID>));
+		}
+		if (data.node_path_cache->size() >= NODE_PATH_CACHE_MAX) {
+			data.node_path_cache->clear();
+		}
+		data.node_path_cache->set(p_path, node->get_instance_id());
+	}
+
+	return node;
+}
+
 Node *Node::get_node(const NodePath &p_path) const {
 	Node *node = get_node_or_null(p_path);
 	ERR_FAIL_COND_V_MSG(!node, nullptr, "Node not found: " + p_path + ".");
@@ -2756,6 +2872,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process", "enable"), &Node::set_process);
 	ClassDB::bind_method(D_METHOD("set_process_priority", "priority"), &Node::set_process_priority);
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
+	ClassDB::bind_method(D_METHOD("set_process_thread_group", "group"), &Node::set_process_thread_group);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group"), &Node::get_process_thread_group);
 	ClassDB::bind_method(D_METHOD("is_processing"), &Node::is_processing);
 	ClassDB::bind_method(D_METHOD("set_process_input", "enable"), &Node::set_process_input);
 	ClassDB::bind_method(D_METHOD("is_processing_input"), &Node::is_processing_input);
@@ -2871,6 +2989,9 @@ void Node::_bind_methods() {
 	BIND_ENUM_CONSTANT(PAUSE_MODE_STOP);
 	BIND_ENUM_CONSTANT(PAUSE_MODE_PROCESS);
 
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_MAIN_THREAD);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD);
+
 	BIND_ENUM_CONSTANT(DUPLICATE_SIGNALS);
 	BIND_ENUM_CONSTANT(DUPLICATE_GROUPS);
 	BIND_ENUM_CONSTANT(DUPLICATE_SCRIPTS);
@@ -2891,6 +3012,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "multiplayer", PROPERTY_HINT_RESOURCE_TYPE, "MultiplayerAPI", 0), "", "get_multiplayer");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "custom_multiplayer", PROPERTY_HINT_RESOURCE_TYPE, "MultiplayerAPI", 0), "set_custom_multiplayer", "get_custom_multiplayer");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 
 	BIND_VMETHOD(MethodInfo("_process", PropertyInfo(Variant::FLOAT, "delta")));
 	BIND_VMETHOD(MethodInfo("_physics_process", PropertyInfo(Variant::FLOAT, "delta")));
@@ -2926,6 +3048,7 @@ Node::Node() {
 	data.physics_process = false;
 	data.idle_process = false;
 	data.process_priority = 0;
+	data.process_thread_group = PROCESS_THREAD_GROUP_MAIN_THREAD;
 	data.physics_process_internal = false;
 	data.idle_process_internal = false;
 	data.inside_tree = false;
@@ -2945,6 +3068,8 @@ Node::Node() {
 	data.viewport = nullptr;
 	data.use_placeholder = false;
 	data.display_folded = false;
+	data.children_indexed = false;
+	data.node_path_cache = nullptr;
 	data.ready_first = true;
 
 	orphan_node_count++;
@@ -2955,6 +3080,10 @@ Node::~Node() {
 	data.owned.clear();
 	data.children.clear();
 
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+	}
+
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children.size());
 
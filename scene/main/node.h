@@ -54,6 +54,12 @@ public:
 		PAUSE_MODE_PROCESS
 	};
 
+	enum ProcessThreadGroup {
+
+		PROCESS_THREAD_GROUP_MAIN_THREAD,
+		PROCESS_THREAD_GROUP_SUB_THREAD
+	};
+
 	enum DuplicateFlags {
 
 		DUPLICATE_SIGNALS = 1,
@@ -97,6 +103,9 @@ private:
 		Node *parent;
 		Node *owner;
 		Vector<Node *> children; // list of children
+		HashMap<StringName, Node *> children_by_name; // only kept for nodes with many children
+		bool children_indexed;
+		mutable HashMap<StringName, int> child_name_serials; // last number given to each base name by _generate_serial_child_name()
 		int pos;
 		int depth;
 		int blocked; // safeguard that throws an error when attempting to modify the tree in a harmful way while being traversed.
@@ -127,6 +136,7 @@ private:
 		bool physics_process;
 		bool idle_process;
 		int process_priority;
+		ProcessThreadGroup process_thread_group;
 
 		bool physics_process_internal;
 		bool idle_process_internal;
@@ -143,6 +153,9 @@ private:
 
 		mutable NodePath *path_cache;
 
+		// Multi level paths resolved by get_node_or_null(), checked against the found node's ancestry on use.
+		mutable HashMap<NodePath, ObjectID> *node_path_cache;
+
 	} data;
 
 	enum NameCasing {
@@ -156,7 +169,18 @@ private:
 	void _print_tree_pretty(const String &prefix, const bool last);
 	void _print_tree(const Node *p_node);
 
+	enum {
+		CHILD_NAME_INDEX_MIN_CHILDREN = 32,
+		NODE_PATH_CACHE_MAX = 64
+	};
+
+	Node *_resolve_node_path(const NodePath &p_path) const;
+	bool _is_node_at_path(const Node *p_node, const NodePath &p_path) const;
+
 	Node *_get_child_by_name(const StringName &p_name) const;
+	bool _has_child_named(const StringName &p_name, const Node *p_exclude) const;
+	void _index_child_name(Node *p_child);
+	void _unindex_child_name(Node *p_child, const StringName &p_name);
 
 	void _replace_connections_target(Node *p_new_target);
 
@@ -355,6 +379,9 @@ public:
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
+	void set_process_thread_group(ProcessThreadGroup p_group);
+	ProcessThreadGroup get_process_thread_group() const;
+
 	void set_process_input(bool p_enable);
 	bool is_processing_input() const;
 
@@ -469,6 +496,7 @@ public:
 };
 
 VARIANT_ENUM_CAST(Node::DuplicateFlags);
+VARIANT_ENUM_CAST(Node::ProcessThreadGroup);
 
 typedef Set<Node *, Node::Comparator> NodeSet;
 
@@ -31,6 +31,7 @@
 #include "scene_tree.h"
 
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/input/input.h"
 #include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
@@ -38,6 +39,7 @@
 #include "core/os/dir_access.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/print_string.h"
 #include "core/project_settings.h"
 #include "node.h"
@@ -119,60 +121,71 @@ void SceneTree::node_renamed(Node *p_node) {
 }
 
 SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_node) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
-		E = group_map.insert(p_group, Group());
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
+		g = &group_map.set(p_group, Group())->value();
 	}
 
-	ERR_FAIL_COND_V_MSG(E->get().nodes.find(p_node) != -1, &E->get(), "Already in group: " + p_group + ".");
-	E->get().nodes.push_back(p_node);
-	//E->get().last_tree_version=0;
-	E->get().changed = true;
-	return &E->get();
+	// Node keeps its own group set, so it never adds itself twice.
+	g->nodes.push_back(p_node);
+	g->changed = true;
+	return g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	ERR_FAIL_COND(!E);
+	Group *g = group_map.getptr(p_group);
+	ERR_FAIL_COND(!g);
 
-	E->get().nodes.erase(p_node);
-	if (E->get().nodes.empty()) {
-		group_map.erase(E);
+	g->nodes.erase(p_node);
+	if (g->nodes.empty()) {
+		group_map.erase(p_group);
 	}
 }
 
 void SceneTree::make_group_changed(const StringName &p_group) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (E) {
-		E->get().changed = true;
+	Group *g = group_map.getptr(p_group);
+	if (g) {
+		g->changed = true;
 	}
 }
 
 void SceneTree::flush_transform_notifications() {
+	bool was_flushing = xform_flushing;
+	xform_flushing = true;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
 		SelfList<Node> *nx = n->next();
 		xform_change_list.remove(n);
 		n = nx;
+		xform_pass++;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	xform_flushing = was_flushing;
+
+	if (!xform_flushing && xform_instances.size()) {
+		RS::get_singleton()->instances_set_transforms(xform_instances, xform_instance_transforms);
+		xform_instances.clear();
+		xform_instance_transforms.clear();
+	}
 }
 
 void SceneTree::_flush_ugc() {
 	ugc_locked = true;
 
 	while (unique_group_calls.size()) {
-		Map<UGCall, Vector<Variant>>::Element *E = unique_group_calls.front();
+		UGCall ug = *unique_group_calls.next(nullptr);
+		Vector<Variant> args = unique_group_calls[ug];
+		unique_group_calls.erase(ug);
 
-		Variant v[VARIANT_ARG_MAX];
-		for (int i = 0; i < E->get().size(); i++) {
-			v[i] = E->get()[i];
+		const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * MAX(1, args.size()));
+		for (int i = 0; i < args.size(); i++) {
+			argptrs[i] = &args[i];
 		}
 
-		call_group_flags(GROUP_CALL_REALTIME, E->key().group, E->key().call, v[0], v[1], v[2], v[3], v[4]);
-
-		unique_group_calls.erase(E);
+		call_group_flagsp(GROUP_CALL_REALTIME, ug.group, ug.call, argptrs, args.size());
 	}
 
 	ugc_locked = false;
@@ -199,12 +212,49 @@ void SceneTree::_update_group_order(Group &g, bool p_use_priority) {
 	g.changed = false;
 }
 
+void SceneTree::_call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, StringName &r_cached_class, MethodBind *&r_cached_method) {
+	Callable::CallError ce;
+
+	if (p_node->get_script_instance()) {
+		// Scripts may override the method, let Object resolve it.
+		p_node->call(p_function, p_args, p_argcount, ce);
+		return;
+	}
+
+	// Groups are usually made of nodes of the same class, so the method is looked up once per run of equal classes.
+	const StringName &class_name = p_node->get_class_name();
+	if (class_name != r_cached_class) {
+		r_cached_class = class_name;
+		r_cached_method = ClassDB::get_method(class_name, p_function);
+	}
+
+	if (r_cached_method) {
+		r_cached_method->call(p_node, p_args, p_argcount, ce);
+	} else {
+		p_node->call(p_function, p_args, p_argcount, ce);
+	}
+}
+
 void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, VARIANT_ARG_DECLARE) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	VARIANT_ARGPTRS;
+
+	int argc = 0;
+	for (int i = 0; i < VARIANT_ARG_MAX; i++) {
+		if (argptr[i]->get_type() == Variant::NIL) {
+			break;
+		}
+		argc++;
+	}
+
+	call_group_flagsp(p_call_flags, p_group, p_function, argptr, argc);
+}
+
+void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
+	Group *group = group_map.getptr(p_group);
+	if (!group) {
 		return;
 	}
-	Group &g = E->get();
+	Group &g = *group;
 	if (g.nodes.empty()) {
 		return;
 	}
@@ -220,14 +270,10 @@ void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_grou
 			return;
 		}
 
-		VARIANT_ARGPTRS;
-
 		Vector<Variant> args;
-		for (int i = 0; i < VARIANT_ARG_MAX; i++) {
-			if (argptr[i]->get_type() == Variant::NIL) {
-				break;
-			}
-			args.push_back(*argptr[i]);
+		args.resize(p_argcount);
+		for (int i = 0; i < p_argcount; i++) {
+			args.write[i] = *p_args[i];
 		}
 
 		unique_group_calls[ug] = args;
@@ -240,40 +286,33 @@ void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_grou
 	Node **nodes = nodes_copy.ptrw();
 	int node_count = nodes_copy.size();
 
+	StringName cached_class;
+	MethodBind *cached_method = nullptr;
+
 	call_lock++;
 
+	int from = 0;
+	int to = node_count;
+	int step = 1;
 	if (p_call_flags & GROUP_CALL_REVERSE) {
-		for (int i = node_count - 1; i >= 0; i--) {
-			if (call_lock && call_skip.has(nodes[i])) {
-				continue;
-			}
+		from = node_count - 1;
+		to = -1;
+		step = -1;
+	}
 
-			if (p_call_flags & GROUP_CALL_REALTIME) {
-				if (p_call_flags & GROUP_CALL_MULTILEVEL) {
-					nodes[i]->call_multilevel(p_function, VARIANT_ARG_PASS);
-				} else {
-					nodes[i]->call(p_function, VARIANT_ARG_PASS);
-				}
-			} else {
-				MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
-			}
+	for (int i = from; i != to; i += step) {
+		if (call_lock && call_skip.has(nodes[i])) {
+			continue;
 		}
 
-	} else {
-		for (int i = 0; i < node_count; i++) {
-			if (call_lock && call_skip.has(nodes[i])) {
-				continue;
-			}
-
-			if (p_call_flags & GROUP_CALL_REALTIME) {
-				if (p_call_flags & GROUP_CALL_MULTILEVEL) {
-					nodes[i]->call_multilevel(p_function, VARIANT_ARG_PASS);
-				} else {
-					nodes[i]->call(p_function, VARIANT_ARG_PASS);
-				}
+		if (p_call_flags & GROUP_CALL_REALTIME) {
+			if (p_call_flags & GROUP_CALL_MULTILEVEL) {
+				nodes[i]->call_multilevel(p_function, p_args, p_argcount);
 			} else {
-				MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
+				_call_group_node(nodes[i], p_function, p_args, p_argcount, cached_class, cached_method);
 			}
+		} else {
+			MessageQueue::get_singleton()->push_call(nodes[i]->get_instance_id(), p_function, p_args, p_argcount);
 		}
 	}
 
@@ -284,11 +323,11 @@ void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_grou
 }
 
 void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *group = group_map.getptr(p_group);
+	if (!group) {
 		return;
 	}
-	Group &g = E->get();
+	Group &g = *group;
 	if (g.nodes.empty()) {
 		return;
 	}
@@ -335,11 +374,11 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 }
 
 void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *group = group_map.getptr(p_group);
+	if (!group) {
 		return;
 	}
-	Group &g = E->get();
+	Group &g = *group;
 	if (g.nodes.empty()) {
 		return;
 	}
@@ -399,11 +438,16 @@ void SceneTree::set_group(const StringName &p_group, const String &p_name, const
 
 void SceneTree::init() {
 	initialized = true;
+#ifndef NO_THREADS
+	thread_work_pool.init();
+#endif
 	root->_set_tree(this);
 	MainLoop::init();
 }
 
 bool SceneTree::iteration(float p_time) {
+	TRACE_ZONE("SceneTree::iteration");
+
 	root_lock++;
 
 	current_frame++;
@@ -430,6 +474,8 @@ bool SceneTree::iteration(float p_time) {
 }
 
 bool SceneTree::idle(float p_time) {
+	TRACE_ZONE("SceneTree::idle");
+
 	//print_line("ram: "+itos(OS::get_singleton()->get_static_memory_usage())+" sram: "+itos(OS::get_singleton()->get_dynamic_memory_usage()));
 	//print_line("node count: "+itos(get_node_count()));
 	//print_line("TEXTURE RAM: "+itos(RS::get_singleton()->get_render_info(RS::INFO_TEXTURE_MEM_USED)));
@@ -544,6 +590,21 @@ void SceneTree::finish() {
 		E->get()->release_connections();
 	}
 	timers.clear();
+
+#ifndef NO_THREADS
+	thread_work_pool.finish();
+#endif
+}
+
+ThreadWorkPool *SceneTree::get_thread_work_pool() {
+#ifdef NO_THREADS
+	return nullptr;
+#else
+	if (!initialized || Thread::get_caller_id() != Thread::get_main_id()) {
+		return nullptr; // The pool can't be used from its own workers.
+	}
+	return &thread_work_pool;
+#endif
 }
 
 void SceneTree::quit(int p_exit_code) {
@@ -787,11 +848,11 @@ bool SceneTree::is_paused() const {
 }
 
 void SceneTree::_notify_group_pause(const StringName &p_group, int p_notification) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *group = group_map.getptr(p_group);
+	if (!group) {
 		return;
 	}
-	Group &g = E->get();
+	Group &g = *group;
 	if (g.nodes.empty()) {
 		return;
 	}
@@ -805,6 +866,10 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 	int node_count = nodes_copy.size();
 	Node **nodes = nodes_copy.ptrw();
 
+	// Only the script callbacks may run in sub threads, internal processing stays on the main thread.
+	bool can_thread = (p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS) && !threaded_processing && get_thread_work_pool();
+	int threaded_priority = 0;
+
 	call_lock++;
 
 	for (int i = 0; i < node_count; i++) {
@@ -820,16 +885,94 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 			continue;
 		}
 
+		// Sub thread nodes of equal priority run as one batch, before any node of a later priority.
+		if (threaded_process_nodes.size() && n->data.process_priority != threaded_priority) {
+			_process_threaded_nodes();
+		}
+
+		if (can_thread && n->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD) {
+			threaded_priority = n->data.process_priority;
+			threaded_process_notification = p_notification;
+			threaded_process_nodes.push_back(n);
+			continue;
+		}
+
 		n->notification(p_notification);
 		//ERR_FAIL_COND(node_count != g.nodes.size());
 	}
 
+	if (threaded_process_nodes.size()) {
+		_process_threaded_nodes();
+	}
+
 	call_lock--;
 	if (call_lock == 0) {
 		call_skip.clear();
 	}
 }
 
+void SceneTree::_process_threaded_nodes() {
+	// The main thread nodes of the same priority ran after these were queued, and may
+	// have removed or freed some of them. Those were put in call_skip when they left
+	// the group, so they are dropped here without touching them.
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < threaded_process_nodes.size(); i++) {
+		Node *n = threaded_process_nodes[i];
+		if (call_lock && call_skip.has(n)) {
+			continue;
+		}
+		if (!n->can_process() || !n->can_process_notification(threaded_process_notification)) {
+			continue;
+		}
+		threaded_process_nodes[count++] = n;
+	}
+	threaded_process_nodes.resize(count);
+
+	if (count == 0) {
+		return;
+	} else if (count == 1) {
+		threaded_process_nodes[0]->notification(threaded_process_notification);
+	} else {
+		threaded_processing = true;
+		thread_work_pool.do_work(threaded_process_nodes.size(), this, &SceneTree::_process_threaded_node, &threaded_process_nodes[0]);
+		threaded_processing = false;
+	}
+
+	threaded_process_nodes.clear();
+}
+
+void SceneTree::_process_threaded_node(uint32_t p_index, Node **p_nodes) {
+	p_nodes[p_index]->notification(threaded_process_notification);
+}
+
+bool SceneTree::_is_threaded_process_caller() const {
+	return threaded_processing && Thread::get_caller_id() != Thread::get_main_id();
+}
+
+void SceneTree::_add_xform_change(SelfList<Node> *p_item) {
+	// Sub thread nodes may move themselves (or their children) from their
+	// process callbacks, so the shared list must be locked meanwhile.
+	if (threaded_processing) {
+		MutexLock lock(xform_change_mutex);
+		if (!p_item->in_list()) {
+			xform_change_list.add(p_item);
+		}
+	} else if (!p_item->in_list()) {
+		xform_change_list.add(p_item);
+	}
+}
+
+void SceneTree::_remove_xform_change(SelfList<Node> *p_item) {
+	if (threaded_processing) {
+		MutexLock lock(xform_change_mutex);
+		if (p_item->in_list()) {
+			xform_change_list.remove(p_item);
+		}
+	} else if (p_item->in_list()) {
+		xform_change_list.remove(p_item);
+	}
+}
+
 /*
 void SceneMainLoop::_update_listener_2d() {
 
@@ -843,11 +986,11 @@ void SceneMainLoop::_update_listener_2d() {
 */
 
 void SceneTree::_call_input_pause(const StringName &p_group, const StringName &p_method, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *group = group_map.getptr(p_group);
+	if (!group) {
 		return;
 	}
-	Group &g = E->get();
+	Group &g = *group;
 	if (g.nodes.empty()) {
 		return;
 	}
@@ -901,13 +1044,8 @@ Variant SceneTree::_call_group_flags(const Variant **p_args, int p_argcount, Cal
 	int flags = *p_args[0];
 	StringName group = *p_args[1];
 	StringName method = *p_args[2];
-	Variant v[VARIANT_ARG_MAX];
-
-	for (int i = 0; i < MIN(p_argcount - 3, 5); i++) {
-		v[i] = *p_args[i + 3];
-	}
 
-	call_group_flags(flags, group, method, v[0], v[1], v[2], v[3], v[4]);
+	call_group_flagsp(flags, group, method, p_args + 3, p_argcount - 3);
 	return Variant();
 }
 
@@ -920,13 +1058,8 @@ Variant SceneTree::_call_group(const Variant **p_args, int p_argcount, Callable:
 
 	StringName group = *p_args[0];
 	StringName method = *p_args[1];
-	Variant v[VARIANT_ARG_MAX];
-
-	for (int i = 0; i < MIN(p_argcount - 2, 5); i++) {
-		v[i] = *p_args[i + 2];
-	}
 
-	call_group_flags(0, group, method, v[0], v[1], v[2], v[3], v[4]);
+	call_group_flagsp(0, group, method, p_args + 2, p_argcount - 2);
 	return Variant();
 }
 
@@ -940,20 +1073,20 @@ int64_t SceneTree::get_event_count() const {
 
 Array SceneTree::_get_nodes_in_group(const StringName &p_group) {
 	Array ret;
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return ret;
 	}
 
-	_update_group_order(E->get()); //update order just in case
-	int nc = E->get().nodes.size();
+	_update_group_order(*g); //update order just in case
+	int nc = g->nodes.size();
 	if (nc == 0) {
 		return ret;
 	}
 
 	ret.resize(nc);
 
-	Node **ptr = E->get().nodes.ptrw();
+	Node **ptr = g->nodes.ptrw();
 	for (int i = 0; i < nc; i++) {
 		ret[i] = ptr[i];
 	}
@@ -966,17 +1099,17 @@ bool SceneTree::has_group(const StringName &p_identifier) const {
 }
 
 void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_list) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return;
 	}
 
-	_update_group_order(E->get()); //update order just in case
-	int nc = E->get().nodes.size();
+	_update_group_order(*g); //update order just in case
+	int nc = g->nodes.size();
 	if (nc == 0) {
 		return;
 	}
-	Node **ptr = E->get().nodes.ptrw();
+	Node **ptr = g->nodes.ptrw();
 	for (int i = 0; i < nc; i++) {
 		p_list->push_back(ptr[i]);
 	}
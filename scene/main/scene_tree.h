@@ -31,10 +31,13 @@
 #ifndef SCENE_MAIN_LOOP_H
 #define SCENE_MAIN_LOOP_H
 
+#include "core/hash_map.h"
 #include "core/io/multiplayer_api.h"
+#include "core/local_vector.h"
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
 #include "core/self_list.h"
+#include "core/thread_work_pool.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/world_2d.h"
 #include "scene/resources/world_3d.h"
@@ -100,10 +103,12 @@ private:
 	bool pause;
 	int root_lock;
 
-	Map<StringName, Group> group_map;
+	HashMap<StringName, Group> group_map;
 	bool _quit;
 	bool initialized;
 
+	ThreadWorkPool thread_work_pool;
+
 	StringName tree_changed_name;
 	StringName node_added_name;
 	StringName node_removed_name;
@@ -120,7 +125,8 @@ private:
 		StringName group;
 		StringName call;
 
-		bool operator<(const UGCall &p_with) const { return group == p_with.group ? call < p_with.call : group < p_with.group; }
+		static _FORCE_INLINE_ uint32_t hash(const UGCall &p_val) { return hash_djb2_one_32(p_val.call.hash(), p_val.group.hash()); }
+		bool operator==(const UGCall &p_with) const { return group == p_with.group && call == p_with.call; }
 	};
 
 	//safety for when a node is deleted while a group is being called
@@ -129,11 +135,12 @@ private:
 
 	List<ObjectID> delete_queue;
 
-	Map<UGCall, Vector<Variant>> unique_group_calls;
+	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
 	bool ugc_locked;
 	void _flush_ugc();
 
 	_FORCE_INLINE_ void _update_group_order(Group &g, bool p_use_priority = false);
+	_FORCE_INLINE_ void _call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, StringName &r_cached_class, MethodBind *&r_cached_method);
 	void _update_listener();
 
 	Array _get_nodes_in_group(const StringName &p_group);
@@ -180,6 +187,17 @@ private:
 	void make_group_changed(const StringName &p_group);
 
 	void _notify_group_pause(const StringName &p_group, int p_notification);
+
+	// Nodes in PROCESS_THREAD_GROUP_SUB_THREAD, processed together on the thread work pool.
+	LocalVector<Node *> threaded_process_nodes;
+	int threaded_process_notification = 0;
+	bool threaded_processing = false;
+
+	void _process_threaded_nodes();
+	void _process_threaded_node(uint32_t p_index, Node **p_nodes);
+	bool _is_threaded_process_caller() const;
+	void _add_xform_change(SelfList<Node> *p_item);
+	void _remove_xform_change(SelfList<Node> *p_item);
 	Variant _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -188,8 +206,17 @@ private:
 	friend class CanvasItem;
 	friend class Node3D;
 	friend class Viewport;
+	friend class VisualInstance3D;
 
 	SelfList<Node>::List xform_change_list;
+	Mutex xform_change_mutex; // Only taken while sub thread nodes are processed.
+	uint64_t xform_pass = 1; // Bumped whenever a queued transform notification is sent.
+
+	// Instance transforms set by VisualInstance3D while notifications are flushed,
+	// sent to the RenderingServer in one call at the end.
+	bool xform_flushing = false;
+	LocalVector<RID> xform_instances;
+	LocalVector<Transform> xform_instance_transforms;
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -230,6 +257,7 @@ public:
 	_FORCE_INLINE_ Window *get_root() const { return root; }
 
 	void call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, VARIANT_ARG_LIST);
+	void call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount);
 	void notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification);
 	void set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value);
 
@@ -328,6 +356,10 @@ public:
 
 	static SceneTree *get_singleton() { return singleton; }
 
+	// Shared worker threads for scene-side batch jobs (e.g. skeleton updates).
+	// Returns nullptr when the tree is not running or threads are disabled.
+	ThreadWorkPool *get_thread_work_pool();
+
 	void get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const;
 
 	//network API
@@ -69,6 +69,7 @@
 #include "scene/animation/animation_blend_space_1d.h"
 #include "scene/animation/animation_blend_space_2d.h"
 #include "scene/animation/animation_blend_tree.h"
+#include "scene/animation/animation_lod.h"
 #include "scene/animation/animation_node_state_machine.h"
 #include "scene/animation/animation_player.h"
 #include "scene/animation/animation_tree.h"
@@ -382,6 +383,7 @@ void register_scene_types() {
 	ClassDB::register_class<Skeleton3D>();
 
 	ClassDB::register_class<AnimationPlayer>();
+	ClassDB::register_class<AnimationLOD>();
 	ClassDB::register_class<Tween>();
 
 	ClassDB::register_class<AnimationTree>();
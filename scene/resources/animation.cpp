@@ -76,6 +76,51 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 			track_set_imported(track, p_value);
 		} else if (what == "enabled") {
 			track_set_enabled(track, p_value);
+		} else if (what == "compressed_keys") {
+			ERR_FAIL_COND_V(track_get_type(track) != TYPE_TRANSFORM, false);
+			TransformTrack *tt = static_cast<TransformTrack *>(tracks[track]);
+			Dictionary d = p_value;
+			ERR_FAIL_COND_V(!d.has("page_length") || !d.has("loc_bounds") || !d.has("scale_bounds") || !d.has("pages") || !d.has("keys"), false);
+
+			Vector<int> pages = d["pages"];
+			Vector<uint8_t> keys = d["keys"];
+			Vector<float> transitions = d.has("transitions") ? Vector<float>(d["transitions"]) : Vector<float>();
+			int key_count = keys.size() / sizeof(CompressedTransformKey);
+			ERR_FAIL_COND_V(keys.size() % sizeof(CompressedTransformKey), false);
+			ERR_FAIL_COND_V(pages.size() < 2 || pages.size() > 65536 || pages[0] != 0 || pages[pages.size() - 1] != key_count, false);
+			ERR_FAIL_COND_V(transitions.size() && transitions.size() != key_count, false);
+			float page_length = d["page_length"];
+			ERR_FAIL_COND_V(!(page_length > 0), false);
+
+			// Seeking trusts the page table, so every key must be inside the page that lists it.
+			const CompressedTransformKey *src_keys = (const CompressedTransformKey *)keys.ptr();
+			for (int i = 0; i < pages.size() - 1; i++) {
+				ERR_FAIL_COND_V(pages[i + 1] < pages[i] || pages[i + 1] > key_count, false);
+				for (int j = pages[i]; j < pages[i + 1]; j++) {
+					ERR_FAIL_COND_V(src_keys[j].page != i, false);
+				}
+			}
+
+			CompressedTransforms *c = memnew(CompressedTransforms);
+			c->page_length = page_length;
+			c->loc_bounds = d["loc_bounds"];
+			c->scale_bounds = d["scale_bounds"];
+			c->pages.resize(pages.size());
+			for (int i = 0; i < pages.size(); i++) {
+				c->pages.write[i] = pages[i];
+			}
+			c->keys.resize(key_count);
+			if (key_count) {
+				copymem(c->keys.ptrw(), keys.ptr(), keys.size());
+			}
+			c->transitions = transitions;
+
+			tt->transforms.clear();
+			if (tt->compressed) {
+				memdelete(tt->compressed);
+			}
+			tt->compressed = c;
+
 		} else if (what == "keys" || what == "key_values") {
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 				TransformTrack *tt = static_cast<TransformTrack *>(tracks[track]);
@@ -85,6 +130,10 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 
 				const float *r = values.ptr();
 
+				if (tt->compressed) {
+					memdelete(tt->compressed);
+					tt->compressed = nullptr;
+				}
 				tt->transforms.resize(vcount / 12);
 
 				for (int i = 0; i < (vcount / 12); i++) {
@@ -352,6 +401,32 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 			r_ret = track_is_imported(track);
 		} else if (what == "enabled") {
 			r_ret = track_is_enabled(track);
+		} else if (what == "compressed_keys") {
+			ERR_FAIL_COND_V(!track_is_compressed(track), false);
+			const CompressedTransforms *c = static_cast<const TransformTrack *>(tracks[track])->compressed;
+
+			Vector<int> pages;
+			pages.resize(c->pages.size());
+			for (int i = 0; i < c->pages.size(); i++) {
+				pages.write[i] = c->pages[i];
+			}
+			Vector<uint8_t> keys;
+			keys.resize(c->keys.size() * sizeof(CompressedTransformKey));
+			if (c->keys.size()) {
+				copymem(keys.ptrw(), c->keys.ptr(), keys.size());
+			}
+
+			Dictionary d;
+			d["page_length"] = c->page_length;
+			d["loc_bounds"] = c->loc_bounds;
+			d["scale_bounds"] = c->scale_bounds;
+			d["pages"] = pages;
+			d["keys"] = keys;
+			if (c->transitions.size()) {
+				d["transitions"] = c->transitions;
+			}
+			r_ret = d;
+
 		} else if (what == "keys") {
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 				Vector<float> keys;
@@ -578,7 +653,11 @@ void Animation::_get_property_list(List<PropertyInfo> *p_list) const {
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/loop_wrap", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/imported", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/enabled", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
-		p_list->push_back(PropertyInfo(Variant::ARRAY, "tracks/" + itos(i) + "/keys", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		if (track_is_compressed(i)) {
+			p_list->push_back(PropertyInfo(Variant::DICTIONARY, "tracks/" + itos(i) + "/compressed_keys", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		} else {
+			p_list->push_back(PropertyInfo(Variant::ARRAY, "tracks/" + itos(i) + "/keys", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		}
 	}
 }
 
@@ -628,7 +707,7 @@ void Animation::remove_track(int p_track) {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
-			_clear(tt->transforms);
+			_clear(tt->transforms); // Compressed keys are freed with the track.
 
 		} break;
 		case TYPE_VALUE: {
@@ -778,16 +857,24 @@ Error Animation::transform_track_get_key(int p_track, int p_key, Vector3 *r_loc,
 
 	TransformTrack *tt = static_cast<TransformTrack *>(t);
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, ERR_INVALID_PARAMETER);
-	ERR_FAIL_INDEX_V(p_key, tt->transforms.size(), ERR_INVALID_PARAMETER);
+
+	TransformKey key;
+	if (tt->compressed) {
+		ERR_FAIL_INDEX_V(p_key, tt->compressed->size(), ERR_INVALID_PARAMETER);
+		key = tt->compressed->get_value(p_key);
+	} else {
+		ERR_FAIL_INDEX_V(p_key, tt->transforms.size(), ERR_INVALID_PARAMETER);
+		key = tt->transforms[p_key].value;
+	}
 
 	if (r_loc) {
-		*r_loc = tt->transforms[p_key].value.loc;
+		*r_loc = key.loc;
 	}
 	if (r_rot) {
-		*r_rot = tt->transforms[p_key].value.rot;
+		*r_rot = key.rot;
 	}
 	if (r_scale) {
-		*r_scale = tt->transforms[p_key].value.scale;
+		*r_scale = key.scale;
 	}
 
 	return OK;
@@ -806,6 +893,7 @@ int Animation::transform_track_insert_key(int p_track, float p_time, const Vecto
 	tkey.value.rot = p_rot;
 	tkey.value.scale = p_scale;
 
+	_transform_track_decompress(tt);
 	int ret = _insert(p_time, tt->transforms, tkey);
 	emit_changed();
 	return ret;
@@ -824,6 +912,7 @@ void Animation::track_remove_key(int p_track, int p_idx) {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_idx, tt->transforms.size());
 			tt->transforms.remove(p_idx);
 
@@ -870,6 +959,16 @@ int Animation::track_find_key(int p_track, float p_time, bool p_exact) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				int k = _find(*tt->compressed, p_time);
+				if (k < 0 || k >= tt->compressed->size()) {
+					return -1;
+				}
+				if (tt->compressed->get_time(k) != p_time && p_exact) {
+					return -1;
+				}
+				return k;
+			}
 			int k = _find(tt->transforms, p_time);
 			if (k < 0 || k >= tt->transforms.size()) {
 				return -1;
@@ -1054,7 +1153,7 @@ int Animation::track_get_key_count(int p_track) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
-			return tt->transforms.size();
+			return tt->compressed ? tt->compressed->size() : tt->transforms.size();
 		} break;
 		case TYPE_VALUE: {
 			ValueTrack *vt = static_cast<ValueTrack *>(t);
@@ -1089,12 +1188,20 @@ Variant Animation::track_get_key_value(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
-			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), Variant());
+
+			TransformKey key;
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed->size(), Variant());
+				key = tt->compressed->get_value(p_key_idx);
+			} else {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), Variant());
+				key = tt->transforms[p_key_idx].value;
+			}
 
 			Dictionary d;
-			d["location"] = tt->transforms[p_key_idx].value.loc;
-			d["rotation"] = tt->transforms[p_key_idx].value.rot;
-			d["scale"] = tt->transforms[p_key_idx].value.scale;
+			d["location"] = key.loc;
+			d["rotation"] = key.rot;
+			d["scale"] = key.scale;
 
 			return d;
 		} break;
@@ -1157,6 +1264,10 @@ float Animation::track_get_key_time(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed->size(), -1);
+				return tt->compressed->get_time(p_key_idx);
+			}
 			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
 			return tt->transforms[p_key_idx].time;
 		} break;
@@ -1202,6 +1313,7 @@ void Animation::track_set_key_time(int p_track, int p_key_idx, float p_time) {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			TKey<TransformKey> key = tt->transforms[p_key_idx];
 			key.time = p_time;
@@ -1266,6 +1378,10 @@ float Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed->size(), -1);
+				return tt->compressed->get_transition(p_key_idx);
+			}
 			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
 			return tt->transforms[p_key_idx].transition;
 		} break;
@@ -1302,6 +1418,7 @@ void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 
 			Dictionary d = p_value;
@@ -1385,6 +1502,7 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, float p_tra
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			tt->transforms.write[p_key_idx].transition = p_transition;
 		} break;
@@ -1448,6 +1566,63 @@ int Animation::_find(const Vector<K> &p_keys, float p_time) const {
 	return middle;
 }
 
+int Animation::_find(const CompressedTransforms &p_keys, float p_time) const {
+	int len = p_keys.size();
+	if (len == 0) {
+		return -2;
+	}
+
+	// The page gives the range of keys to look at right away. If none of
+	// them is at or before p_time, the answer is the last key of the
+	// previous pages.
+	int page_count = p_keys.pages.size() - 1;
+	int page = CLAMP(int(p_time / p_keys.page_length), 0, page_count - 1);
+	int low = p_keys.pages[page];
+	int high = p_keys.pages[page + 1];
+
+	while (low < high) {
+		int middle = (low + high) / 2;
+		float time = p_keys.get_time(middle);
+
+		if (time <= p_time || Math::is_equal_approx(p_time, time)) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	return low - 1;
+}
+
+template <class K>
+int Animation::_find_from_cursor(const K &p_keys, float p_time, int *r_cursor) const {
+	if (!r_cursor) {
+		return _find(p_keys, p_time);
+	}
+
+	// When playing forward, the key is usually the same as last time or the
+	// one right after it.
+	int len = p_keys.size();
+	for (int idx = *r_cursor; idx >= 0 && idx < len && idx <= *r_cursor + 1; idx++) {
+		float time = _key_time(p_keys, idx);
+		if (time > p_time && !Math::is_equal_approx(p_time, time)) {
+			break;
+		}
+		if (idx + 1 < len) {
+			float next_time = _key_time(p_keys, idx + 1);
+			if (next_time <= p_time || Math::is_equal_approx(p_time, next_time)) {
+				continue;
+			}
+		}
+		*r_cursor = idx;
+		return idx;
+	}
+
+	int idx = _find(p_keys, p_time);
+	*r_cursor = idx;
+	return idx;
+}
+
 Animation::TransformKey Animation::_interpolate(const Animation::TransformKey &p_a, const Animation::TransformKey &p_b, float p_c) const {
 	TransformKey ret;
 	ret.loc = _interpolate(p_a.loc, p_b.loc, p_c);
@@ -1582,9 +1757,12 @@ float Animation::_cubic_interpolate(const float &p_pre_a, const float &p_a, cons
 	return _interpolate(p_a, p_b, p_c);
 }
 
-template <class T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+template <class T, class K>
+T Animation::_interpolate_keys(const K &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, int *r_cursor) const {
+	int len = p_keys.size();
+	if (len == 0 || _key_time(p_keys, len - 1) > length) {
+		len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+	}
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -1598,10 +1776,10 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 		if (p_ok) {
 			*p_ok = true;
 		}
-		return p_keys[0].value;
+		return _key_value(p_keys, 0);
 	}
 
-	int idx = _find(p_keys, p_time);
+	int idx = _find_from_cursor(p_keys, p_time, r_cursor);
 
 	ERR_FAIL_COND_V(idx == -2, T());
 
@@ -1615,8 +1793,8 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 		if (idx >= 0) {
 			if ((idx + 1) < len) {
 				next = idx + 1;
-				float delta = p_keys[next].time - p_keys[idx].time;
-				float from = p_time - p_keys[idx].time;
+				float delta = _key_time(p_keys, next) - _key_time(p_keys, idx);
+				float from = p_time - _key_time(p_keys, idx);
 
 				if (Math::is_zero_approx(delta)) {
 					c = 0;
@@ -1626,8 +1804,8 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 
 			} else {
 				next = 0;
-				float delta = (length - p_keys[idx].time) + p_keys[next].time;
-				float from = p_time - p_keys[idx].time;
+				float delta = (length - _key_time(p_keys, idx)) + _key_time(p_keys, next);
+				float from = p_time - _key_time(p_keys, idx);
 
 				if (Math::is_zero_approx(delta)) {
 					c = 0;
@@ -1640,11 +1818,11 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 			// on loop, behind first key
 			idx = len - 1;
 			next = 0;
-			float endtime = (length - p_keys[idx].time);
+			float endtime = (length - _key_time(p_keys, idx));
 			if (endtime < 0) { // may be keys past the end
 				endtime = 0;
 			}
-			float delta = endtime + p_keys[next].time;
+			float delta = endtime + _key_time(p_keys, next);
 			float from = endtime + p_time;
 
 			if (Math::is_zero_approx(delta)) {
@@ -1659,8 +1837,8 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 		if (idx >= 0) {
 			if ((idx + 1) < len) {
 				next = idx + 1;
-				float delta = p_keys[next].time - p_keys[idx].time;
-				float from = p_time - p_keys[idx].time;
+				float delta = _key_time(p_keys, next) - _key_time(p_keys, idx);
+				float from = p_time - _key_time(p_keys, idx);
 
 				if (Math::is_zero_approx(delta)) {
 					c = 0;
@@ -1689,11 +1867,11 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 		return T();
 	}
 
-	float tr = p_keys[idx].transition;
+	float tr = _key_transition(p_keys, idx);
 
 	if (tr == 0 || idx == next) {
 		// don't interpolate if not needed
-		return p_keys[idx].value;
+		return _key_value(p_keys, idx);
 	}
 
 	if (tr != 1.0) {
@@ -1702,10 +1880,10 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 
 	switch (p_interp) {
 		case INTERPOLATION_NEAREST: {
-			return p_keys[idx].value;
+			return _key_value(p_keys, idx);
 		} break;
 		case INTERPOLATION_LINEAR: {
-			return _interpolate(p_keys[idx].value, p_keys[next].value, c);
+			return _interpolate(_key_value(p_keys, idx), _key_value(p_keys, next), c);
 		} break;
 		case INTERPOLATION_CUBIC: {
 			int pre = idx - 1;
@@ -1717,17 +1895,17 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 				post = next;
 			}
 
-			return _cubic_interpolate(p_keys[pre].value, p_keys[idx].value, p_keys[next].value, p_keys[post].value, c);
+			return _cubic_interpolate(_key_value(p_keys, pre), _key_value(p_keys, idx), _key_value(p_keys, next), _key_value(p_keys, post), c);
 
 		} break;
 		default:
-			return p_keys[idx].value;
+			return _key_value(p_keys, idx);
 	}
 
 	// do a barrel roll
 }
 
-Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const {
+Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale, int *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, ERR_INVALID_PARAMETER);
@@ -1736,7 +1914,12 @@ Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3
 
 	bool ok = false;
 
-	TransformKey tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	TransformKey tk;
+	if (tt->compressed) {
+		tk = _interpolate_keys<TransformKey>(*tt->compressed, p_time, tt->interpolation, tt->loop_wrap, &ok, r_cursor);
+	} else {
+		tk = _interpolate_keys<TransformKey>(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok, r_cursor);
+	}
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1873,8 +2056,8 @@ Animation::UpdateMode Animation::value_track_get_update_mode(int p_track) const
 	return vt->update_mode;
 }
 
-template <class T>
-void Animation::_track_get_key_indices_in_range(const Vector<T> &p_array, float from_time, float to_time, List<int> *p_indices) const {
+template <class K>
+void Animation::_track_get_key_indices_in_range(const K &p_array, float from_time, float to_time, List<int> *p_indices) const {
 	if (from_time != length && to_time == length) {
 		to_time = length * 1.01; //include a little more if at the end
 	}
@@ -1884,7 +2067,7 @@ void Animation::_track_get_key_indices_in_range(const Vector<T> &p_array, float
 	// can't really send the events == time, will be sent in the next frame.
 	// if event>=len then it will probably never be requested by the anim player.
 
-	if (to >= 0 && p_array[to].time >= to_time) {
+	if (to >= 0 && _key_time(p_array, to) >= to_time) {
 		to--;
 	}
 
@@ -1895,7 +2078,7 @@ void Animation::_track_get_key_indices_in_range(const Vector<T> &p_array, float
 	int from = _find(p_array, from_time);
 
 	// position in the right first event.+
-	if (from < 0 || p_array[from].time < from_time) {
+	if (from < 0 || _key_time(p_array, from) < from_time) {
 		from++;
 	}
 
@@ -1933,8 +2116,13 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 			switch (t->type) {
 				case TYPE_TRANSFORM: {
 					const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-					_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
-					_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					if (tt->compressed) {
+						_track_get_key_indices_in_range(*tt->compressed, from_time, length, p_indices);
+						_track_get_key_indices_in_range(*tt->compressed, 0, to_time, p_indices);
+					} else {
+						_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
+						_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					}
 
 				} break;
 				case TYPE_VALUE: {
@@ -1989,7 +2177,11 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-			_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			if (tt->compressed) {
+				_track_get_key_indices_in_range(*tt->compressed, from_time, to_time, p_indices);
+			} else {
+				_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			}
 
 		} break;
 		case TYPE_VALUE: {
@@ -2874,6 +3066,7 @@ void Animation::_transform_track_optimize(int p_idx, float p_allowed_linear_err,
 	ERR_FAIL_INDEX(p_idx, tracks.size());
 	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_TRANSFORM);
 	TransformTrack *tt = static_cast<TransformTrack *>(tracks[p_idx]);
+	_transform_track_decompress(tt);
 	bool prev_erased = false;
 	TKey<TransformKey> first_erased;
 
@@ -2918,6 +3111,131 @@ void Animation::optimize(float p_allowed_linear_err, float p_allowed_angular_err
 	}
 }
 
+static _FORCE_INLINE_ uint16_t _quantize_unorm16(float p_value) {
+	return (uint16_t)CLAMP(Math::fast_ftoi(p_value * 65535.0), 0, 65535);
+}
+
+static _FORCE_INLINE_ int16_t _quantize_snorm16(float p_value) {
+	return (int16_t)CLAMP(Math::fast_ftoi(p_value * 32767.0), -32767, 32767);
+}
+
+static _FORCE_INLINE_ void _quantize_vector3(const Vector3 &p_value, const AABB &p_bounds, uint16_t *r_value) {
+	for (int i = 0; i < 3; i++) {
+		r_value[i] = p_bounds.size[i] > 0 ? _quantize_unorm16((p_value[i] - p_bounds.position[i]) / p_bounds.size[i]) : 0;
+	}
+}
+
+void Animation::_transform_track_compress(TransformTrack *p_track) {
+	if (p_track->compressed || p_track->transforms.empty()) {
+		return;
+	}
+
+	const TKey<TransformKey> *src = p_track->transforms.ptr();
+	int count = p_track->transforms.size();
+	float page_length = COMPRESSED_PAGE_LENGTH;
+	int page_count = int(src[count - 1].time / page_length) + 1;
+
+	// Pages are addressed from time zero, and a key stores its page in 16 bits.
+	if (src[0].time < 0 || page_count > 65535) {
+		return;
+	}
+
+	CompressedTransforms *c = memnew(CompressedTransforms);
+	c->page_length = page_length;
+	c->loc_bounds = AABB(src[0].value.loc, Vector3());
+	c->scale_bounds = AABB(src[0].value.scale, Vector3());
+	bool unit_transitions = true;
+
+	for (int i = 0; i < count; i++) {
+		c->loc_bounds.expand_to(src[i].value.loc);
+		c->scale_bounds.expand_to(src[i].value.scale);
+		if (src[i].transition != 1.0) {
+			unit_transitions = false;
+		}
+	}
+
+	c->pages.resize(page_count + 1);
+	c->keys.resize(count);
+	if (!unit_transitions) {
+		c->transitions.resize(count);
+	}
+
+	uint32_t *pages = c->pages.ptrw();
+	CompressedTransformKey *keys = c->keys.ptrw();
+	int page = 0;
+	pages[0] = 0;
+
+	for (int i = 0; i < count; i++) {
+		const TKey<TransformKey> &key = src[i];
+		int key_page = MIN(int(key.time / page_length), page_count - 1);
+		while (page < key_page) {
+			pages[++page] = i;
+		}
+
+		CompressedTransformKey &ck = keys[i];
+		ck.page = key_page;
+		ck.time = _quantize_unorm16((key.time - key_page * page_length) / page_length);
+		_quantize_vector3(key.value.loc, c->loc_bounds, ck.loc);
+		_quantize_vector3(key.value.scale, c->scale_bounds, ck.scale);
+		Quat rot = key.value.rot.normalized();
+		ck.rot[0] = _quantize_snorm16(rot.x);
+		ck.rot[1] = _quantize_snorm16(rot.y);
+		ck.rot[2] = _quantize_snorm16(rot.z);
+		ck.rot[3] = _quantize_snorm16(rot.w);
+
+		if (!unit_transitions) {
+			c->transitions.write[i] = key.transition;
+		}
+	}
+
+	while (page < page_count) {
+		pages[++page] = count;
+	}
+
+	p_track->transforms.clear();
+	p_track->compressed = c;
+}
+
+void Animation::_transform_track_decompress(TransformTrack *p_track) {
+	if (!p_track->compressed) {
+		return;
+	}
+
+	const CompressedTransforms *c = p_track->compressed;
+	p_track->transforms.resize(c->size());
+	TKey<TransformKey> *dst = p_track->transforms.ptrw();
+
+	for (int i = 0; i < c->size(); i++) {
+		dst[i].time = c->get_time(i);
+		dst[i].transition = c->get_transition(i);
+		dst[i].value = c->get_value(i);
+	}
+
+	memdelete(p_track->compressed);
+	p_track->compressed = nullptr;
+}
+
+// Quantizes the keys of all transform tracks into 24 bytes each (down from
+// 48), grouped in pages of fixed duration for constant time seeking. Meant
+// to be used after optimize(), once the animation won't be edited anymore:
+// editing keys of a compressed track decompresses it.
+void Animation::compress() {
+	for (int i = 0; i < tracks.size(); i++) {
+		if (tracks[i]->type == TYPE_TRANSFORM) {
+			_transform_track_compress(static_cast<TransformTrack *>(tracks[i]));
+		}
+	}
+	emit_changed();
+}
+
+bool Animation::track_is_compressed(int p_track) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
+	if (tracks[p_track]->type != TYPE_TRANSFORM) {
+		return false;
+	}
+	return static_cast<const TransformTrack *>(tracks[p_track])->compressed != nullptr;
+}
+
 Animation::Animation() {
 	step = 0.1;
 	loop = false;
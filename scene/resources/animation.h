@@ -101,10 +101,58 @@ private:
 
 	/* TRANSFORM TRACK */
 
+	enum {
+		COMPRESSED_PAGE_LENGTH = 1, // Seconds of animation covered by each page.
+	};
+
+	// Quantized transform key, see compress().
+	struct CompressedTransformKey {
+		uint16_t page;
+		uint16_t time; // Offset from the start of its page.
+		uint16_t loc[3]; // Relative to the track bounds.
+		int16_t rot[4]; // Normalized quaternion.
+		uint16_t scale[3]; // Relative to the track bounds.
+	};
+
+	// Keys are grouped in pages of fixed duration, so finding the page a
+	// given time falls in doesn't need any search.
+	struct CompressedTransforms {
+		float page_length = COMPRESSED_PAGE_LENGTH;
+		AABB loc_bounds;
+		AABB scale_bounds;
+		Vector<uint32_t> pages; // First key of each page, followed by the key count.
+		Vector<CompressedTransformKey> keys;
+		Vector<float> transitions; // Empty when all transitions are 1.
+
+		_FORCE_INLINE_ int size() const { return keys.size(); }
+		_FORCE_INLINE_ float get_time(int p_idx) const {
+			const CompressedTransformKey &key = keys[p_idx];
+			return (key.page + key.time * (1.0 / 65535.0)) * page_length;
+		}
+		_FORCE_INLINE_ float get_transition(int p_idx) const { return transitions.size() ? transitions[p_idx] : 1.0; }
+		_FORCE_INLINE_ TransformKey get_value(int p_idx) const {
+			const CompressedTransformKey &key = keys[p_idx];
+			const float u16 = 1.0 / 65535.0;
+			const float s16 = 1.0 / 32767.0;
+
+			TransformKey ret;
+			ret.loc = loc_bounds.position + loc_bounds.size * (Vector3(key.loc[0], key.loc[1], key.loc[2]) * u16);
+			ret.rot = Quat(key.rot[0] * s16, key.rot[1] * s16, key.rot[2] * s16, key.rot[3] * s16).normalized();
+			ret.scale = scale_bounds.position + scale_bounds.size * (Vector3(key.scale[0], key.scale[1], key.scale[2]) * u16);
+			return ret;
+		}
+	};
+
 	struct TransformTrack : public Track {
 		Vector<TKey<TransformKey>> transforms;
+		CompressedTransforms *compressed = nullptr; // When set, transforms is empty.
 
 		TransformTrack() { type = TYPE_TRANSFORM; }
+		~TransformTrack() {
+			if (compressed) {
+				memdelete(compressed);
+			}
+		}
 	};
 
 	/* PROPERTY VALUE TRACK */
@@ -192,6 +240,23 @@ private:
 
 	template <class K>
 	inline int _find(const Vector<K> &p_keys, float p_time) const;
+	int _find(const CompressedTransforms &p_keys, float p_time) const;
+	template <class K>
+	_FORCE_INLINE_ int _find_from_cursor(const K &p_keys, float p_time, int *r_cursor) const;
+
+	// Key accessors shared by plain and compressed tracks.
+	template <class K>
+	static _FORCE_INLINE_ float _key_time(const Vector<K> &p_keys, int p_idx) { return p_keys[p_idx].time; }
+	template <class K>
+	static _FORCE_INLINE_ float _key_transition(const Vector<K> &p_keys, int p_idx) { return p_keys[p_idx].transition; }
+	template <class T>
+	static _FORCE_INLINE_ const T &_key_value(const Vector<TKey<T>> &p_keys, int p_idx) { return p_keys[p_idx].value; }
+	static _FORCE_INLINE_ float _key_time(const CompressedTransforms &p_keys, int p_idx) { return p_keys.get_time(p_idx); }
+	static _FORCE_INLINE_ float _key_transition(const CompressedTransforms &p_keys, int p_idx) { return p_keys.get_transition(p_idx); }
+	static _FORCE_INLINE_ TransformKey _key_value(const CompressedTransforms &p_keys, int p_idx) { return p_keys.get_value(p_idx); }
+
+	void _transform_track_compress(TransformTrack *p_track);
+	void _transform_track_decompress(TransformTrack *p_track);
 
 	_FORCE_INLINE_ Animation::TransformKey _interpolate(const Animation::TransformKey &p_a, const Animation::TransformKey &p_b, float p_c) const;
 
@@ -206,11 +271,15 @@ private:
 	_FORCE_INLINE_ Variant _cubic_interpolate(const Variant &p_pre_a, const Variant &p_a, const Variant &p_b, const Variant &p_post_b, float p_c) const;
 	_FORCE_INLINE_ float _cubic_interpolate(const float &p_pre_a, const float &p_a, const float &p_b, const float &p_post_b, float p_c) const;
 
+	template <class T, class K>
+	_FORCE_INLINE_ T _interpolate_keys(const K &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, int *r_cursor = nullptr) const;
 	template <class T>
-	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const;
+	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
+		return _interpolate_keys<T>(p_keys, p_time, p_interp, p_loop_wrap, p_ok);
+	}
 
-	template <class T>
-	_FORCE_INLINE_ void _track_get_key_indices_in_range(const Vector<T> &p_array, float from_time, float to_time, List<int> *p_indices) const;
+	template <class K>
+	_FORCE_INLINE_ void _track_get_key_indices_in_range(const K &p_array, float from_time, float to_time, List<int> *p_indices) const;
 
 	_FORCE_INLINE_ void _value_track_get_key_indices_in_range(const ValueTrack *vt, float from_time, float to_time, List<int> *p_indices) const;
 	_FORCE_INLINE_ void _method_track_get_key_indices_in_range(const MethodTrack *mt, float from_time, float to_time, List<int> *p_indices) const;
@@ -329,7 +398,7 @@ public:
 	void track_set_interpolation_loop_wrap(int p_track, bool p_enable);
 	bool track_get_interpolation_loop_wrap(int p_track) const;
 
-	Error transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const;
+	Error transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale, int *r_cursor = nullptr) const;
 
 	Variant value_track_interpolate(int p_track, float p_time) const;
 	void value_track_get_key_indices(int p_track, float p_time, float p_delta, List<int> *p_indices) const;
@@ -357,6 +426,9 @@ public:
 
 	void optimize(float p_allowed_linear_err = 0.05, float p_allowed_angular_err = 0.01, float p_max_optimizable_angle = Math_PI * 0.125);
 
+	void compress();
+	bool track_is_compressed(int p_track) const;
+
 	Animation();
 	~Animation();
 };
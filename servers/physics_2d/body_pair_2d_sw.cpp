@@ -34,6 +34,7 @@
 
 #define POSITION_CORRECTION
 #define ACCUMULATE_IMPULSES
+#define COLLISION_CACHE_TOLERANCE 0.0001 // Relative to the size of the smaller shape.
 
 void BodyPair2DSW::_add_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_self) {
 	BodyPair2DSW *self = (BodyPair2DSW *)p_self;
@@ -211,6 +212,36 @@ bool BodyPair2DSW::_test_ccd(real_t p_step, Body2DSW *p_A, int p_shape_A, const
 	return true;
 }
 
+static _FORCE_INLINE_ bool _xform_close(const Transform2D &p_a, const Transform2D &p_b, real_t p_origin_tolerance2) {
+	const real_t basis_tolerance2 = COLLISION_CACHE_TOLERANCE * COLLISION_CACHE_TOLERANCE;
+	return p_a.elements[0].distance_squared_to(p_b.elements[0]) < basis_tolerance2 &&
+		   p_a.elements[1].distance_squared_to(p_b.elements[1]) < basis_tolerance2 &&
+		   p_a.elements[2].distance_squared_to(p_b.elements[2]) < p_origin_tolerance2;
+}
+
+bool BodyPair2DSW::_collision_cache_matches(const Transform2D &p_xform_A, const Transform2D &p_xform_B, const Shape2DSW *p_shape_A, const Shape2DSW *p_shape_B) const {
+	if (!collision_cache.valid) {
+		return false;
+	}
+
+	if (collision_cache.shape_A != p_shape_A || collision_cache.shape_B != p_shape_B) {
+		return false;
+	}
+
+	if (collision_cache.version_A != p_shape_A->get_version() || collision_cache.version_B != p_shape_B->get_version()) {
+		return false;
+	}
+
+	// Movement is measured against the smaller shape, a fixed distance would be
+	// too coarse for tiny shapes and needlessly strict for large ones.
+	Size2 size_A = p_shape_A->get_aabb().size;
+	Size2 size_B = p_shape_B->get_aabb().size;
+	real_t size = MIN(MAX(size_A.width, size_A.height), MAX(size_B.width, size_B.height));
+	real_t origin_tolerance = COLLISION_CACHE_TOLERANCE * size;
+
+	return _xform_close(collision_cache.xform_A, p_xform_A, origin_tolerance * origin_tolerance) && _xform_close(collision_cache.xform_B, p_xform_B, origin_tolerance * origin_tolerance);
+}
+
 real_t combine_bounce(Body2DSW *A, Body2DSW *B) {
 	return CLAMP(A->get_bounce() + B->get_bounce(), 0, 1);
 }
@@ -259,7 +290,31 @@ bool BodyPair2DSW::setup(real_t p_step) {
 
 	//bool prev_collided=collided;
 
-	collided = CollisionSolver2DSW::solve(shape_A_ptr, xform_A, motion_A, shape_B_ptr, xform_B, motion_B, _add_contact, this, &sep_axis);
+	// Shape casting and raycasting depend on velocities, so only plain overlap tests can be cached.
+	bool use_cache = A->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_DISABLED && B->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_DISABLED;
+
+	if (use_cache && _collision_cache_matches(xform_A, xform_B, shape_A_ptr, shape_B_ptr)) {
+		// Shapes barely moved relative to each other, the narrowphase would report the same contacts again.
+		// Every contact that survived validation was generated last step, so mark it as regenerated.
+		collided = collision_cache.collided;
+		for (int i = 0; i < contact_count; i++) {
+			contacts[i].reused = true;
+		}
+	} else {
+		collided = CollisionSolver2DSW::solve(shape_A_ptr, xform_A, motion_A, shape_B_ptr, xform_B, motion_B, _add_contact, this, &sep_axis);
+
+		collision_cache.valid = use_cache;
+		collision_cache.collided = collided;
+		collision_cache.xform_A = xform_A;
+		collision_cache.xform_B = xform_B;
+		collision_cache.shape_A = shape_A_ptr;
+		collision_cache.shape_B = shape_B_ptr;
+		collision_cache.version_A = shape_A_ptr->get_version();
+		collision_cache.version_B = shape_B_ptr->get_version();
+	}
+
+	space->add_pair_tested(collided);
+
 	if (!collided) {
 		//test ccd (currently just a raycast)
 
@@ -514,6 +569,7 @@ BodyPair2DSW::BodyPair2DSW(Body2DSW *p_A, int p_shape_A, Body2DSW *p_B, int p_sh
 	contact_count = 0;
 	collided = false;
 	oneway_disabled = false;
+	collision_cache.valid = false;
 }
 
 BodyPair2DSW::~BodyPair2DSW() {
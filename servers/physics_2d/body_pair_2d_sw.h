@@ -78,6 +78,20 @@ class BodyPair2DSW : public Constraint2DSW {
 	bool oneway_disabled;
 	int cc;
 
+	// Narrowphase result of the last step, reused while the shapes keep the same relative placement.
+	struct CollisionCache {
+		bool valid;
+		bool collided;
+		Transform2D xform_A;
+		Transform2D xform_B;
+		const Shape2DSW *shape_A;
+		const Shape2DSW *shape_B;
+		uint64_t version_A;
+		uint64_t version_B;
+	} collision_cache;
+
+	_FORCE_INLINE_ bool _collision_cache_matches(const Transform2D &p_xform_A, const Transform2D &p_xform_B, const Shape2DSW *p_shape_A, const Shape2DSW *p_shape_B) const;
+
 	bool _test_ccd(real_t p_step, Body2DSW *p_A, int p_shape_A, const Transform2D &p_xform_A, Body2DSW *p_B, int p_shape_B, const Transform2D &p_xform_B, bool p_swap_result = false);
 	void _validate_contacts();
 	static void _add_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_self);
@@ -106,7 +106,7 @@ void BroadPhase2DHashGrid::_enter_grid(Element *p_elem, const Rect2 &p_rect, boo
 			_pair_attempt(p_elem, &E->get());
 		}
 
-		large_elements[p_elem].inc();
+		(p_static ? large_static_elements : large_elements)[p_elem].inc();
 		return;
 	}
 
@@ -179,7 +179,16 @@ void BroadPhase2DHashGrid::_enter_grid(Element *p_elem, const Rect2 &p_rect, boo
 		if (E->key()->owner == p_elem->owner) {
 			continue;
 		}
-		if (E->key()->_static && p_static) {
+
+		_pair_attempt(E->key(), p_elem);
+	}
+
+	if (p_static) {
+		return; // static elements don't pair with large static ones
+	}
+
+	for (Map<Element *, RC>::Element *E = large_static_elements.front(); E; E = E->next()) {
+		if (E->key()->owner == p_elem->owner) {
 			continue;
 		}
 
@@ -198,8 +207,9 @@ void BroadPhase2DHashGrid::_exit_grid(Element *p_elem, const Rect2 &p_rect, bool
 			E = next;
 		}
 
-		if (large_elements[p_elem].dec() == 0) {
-			large_elements.erase(p_elem);
+		Map<Element *, RC> &large = p_static ? large_static_elements : large_elements;
+		if (large[p_elem].dec() == 0) {
+			large.erase(p_elem);
 		}
 		return;
 	}
@@ -288,11 +298,21 @@ void BroadPhase2DHashGrid::_exit_grid(Element *p_elem, const Rect2 &p_rect, bool
 		if (E->key()->owner == p_elem->owner) {
 			continue;
 		}
-		if (E->key()->_static && p_static) {
+
+		//unpair from large elements
+		_unpair_attempt(p_elem, E->key());
+	}
+
+	if (p_static) {
+		return;
+	}
+
+	for (Map<Element *, RC>::Element *E = large_static_elements.front(); E; E = E->next()) {
+		if (E->key()->owner == p_elem->owner) {
 			continue;
 		}
 
-		//unpair from large elements
+		//unpair from large static elements
 		_unpair_attempt(p_elem, E->key());
 	}
 }
@@ -533,28 +553,27 @@ int BroadPhase2DHashGrid::cull_segment(const Vector2 &p_from, const Vector2 &p_t
 		}
 	}
 
-	for (Map<Element *, RC>::Element *E = large_elements.front(); E; E = E->next()) {
-		if (cullcount >= p_max_results) {
-			break;
-		}
-		if (E->key()->pass == pass) {
-			continue;
-		}
+	for (int k = 0; k < 2; k++) {
+		const Map<Element *, RC> &large = k == 0 ? large_elements : large_static_elements;
 
-		E->key()->pass = pass;
+		for (const Map<Element *, RC>::Element *E = large.front(); E; E = E->next()) {
+			if (cullcount >= p_max_results) {
+				break;
+			}
+			if (E->key()->pass == pass) {
+				continue;
+			}
 
-		/*
-		if (use_aabb && !p_aabb.intersects(E->key()->aabb))
-			continue;
-		*/
+			E->key()->pass = pass;
 
-		if (!E->key()->aabb.intersects_segment(p_from, p_to)) {
-			continue;
-		}
+			if (!E->key()->aabb.intersects_segment(p_from, p_to)) {
+				continue;
+			}
 
-		p_results[cullcount] = E->key()->owner;
-		p_result_indices[cullcount] = E->key()->subindex;
-		cullcount++;
+			p_results[cullcount] = E->key()->owner;
+			p_result_indices[cullcount] = E->key()->subindex;
+			cullcount++;
+		}
 	}
 
 	return cullcount;
@@ -573,28 +592,27 @@ int BroadPhase2DHashGrid::cull_aabb(const Rect2 &p_aabb, CollisionObject2DSW **p
 		}
 	}
 
-	for (Map<Element *, RC>::Element *E = large_elements.front(); E; E = E->next()) {
-		if (cullcount >= p_max_results) {
-			break;
-		}
-		if (E->key()->pass == pass) {
-			continue;
-		}
+	for (int k = 0; k < 2; k++) {
+		const Map<Element *, RC> &large = k == 0 ? large_elements : large_static_elements;
 
-		E->key()->pass = pass;
+		for (const Map<Element *, RC>::Element *E = large.front(); E; E = E->next()) {
+			if (cullcount >= p_max_results) {
+				break;
+			}
+			if (E->key()->pass == pass) {
+				continue;
+			}
 
-		if (!p_aabb.intersects(E->key()->aabb)) {
-			continue;
-		}
+			E->key()->pass = pass;
 
-		/*
-		if (!E->key()->aabb.intersects_segment(p_from,p_to))
-			continue;
-		*/
+			if (!p_aabb.intersects(E->key()->aabb)) {
+				continue;
+			}
 
-		p_results[cullcount] = E->key()->owner;
-		p_result_indices[cullcount] = E->key()->subindex;
-		cullcount++;
+			p_results[cullcount] = E->key()->owner;
+			p_result_indices[cullcount] = E->key()->subindex;
+			cullcount++;
+		}
 	}
 	return cullcount;
 }
@@ -75,6 +75,7 @@ class BroadPhase2DHashGrid : public BroadPhase2DSW {
 
 	Map<ID, Element> element_map;
 	Map<Element *, RC> large_elements;
+	Map<Element *, RC> large_static_elements; // kept apart so static elements never scan each other
 
 	ID current;
 
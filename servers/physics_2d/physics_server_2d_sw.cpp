@@ -34,6 +34,7 @@
 #include "broad_phase_2d_hash_grid.h"
 #include "collision_solver_2d_sw.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/os/os.h"
 #include "core/project_settings.h"
 
@@ -1223,6 +1224,8 @@ void PhysicsServer2DSW::init() {
 };
 
 void PhysicsServer2DSW::step(real_t p_step) {
+	TRACE_ZONE("PhysicsServer2D::step");
+
 	if (!active) {
 		return;
 	}
@@ -1236,11 +1239,19 @@ void PhysicsServer2DSW::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	largest_island = 0;
+	pairs_tested = 0;
+	pairs_colliding = 0;
+	query_count = 0;
 	for (Set<const Space2DSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
 		stepper->step((Space2DSW *)E->get(), p_step, iterations);
 		island_count += E->get()->get_island_count();
 		active_objects += E->get()->get_active_objects();
 		collision_pairs += E->get()->get_collision_pairs();
+		largest_island = MAX(largest_island, E->get()->get_largest_island());
+		pairs_tested += E->get()->get_pairs_tested();
+		pairs_colliding += E->get()->get_pairs_colliding();
+		query_count += E->get()->get_query_count();
 	}
 };
 
@@ -1325,6 +1336,18 @@ int PhysicsServer2DSW::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_LARGEST_ISLAND: {
+			return largest_island;
+		} break;
+		case INFO_PAIRS_TESTED: {
+			return pairs_tested;
+		} break;
+		case INFO_PAIRS_COLLIDING: {
+			return pairs_colliding;
+		} break;
+		case INFO_QUERY_COUNT: {
+			return query_count;
+		} break;
 	}
 
 	return 0;
@@ -1340,6 +1363,10 @@ PhysicsServer2DSW::PhysicsServer2DSW() {
 	active = true;
 	island_count = 0;
 	active_objects = 0;
+	largest_island = 0;
+	pairs_tested = 0;
+	pairs_colliding = 0;
+	query_count = 0;
 	collision_pairs = 0;
 	using_threads = int(ProjectSettings::get_singleton()->get("physics/2d/thread_model")) == 2;
 	flushing_queries = false;
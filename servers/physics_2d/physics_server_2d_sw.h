@@ -51,6 +51,10 @@ class PhysicsServer2DSW : public PhysicsServer2D {
 	int island_count;
 	int active_objects;
 	int collision_pairs;
+	int largest_island;
+	int pairs_tested;
+	int pairs_colliding;
+	int query_count;
 
 	bool using_threads;
 
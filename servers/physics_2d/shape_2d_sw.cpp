@@ -31,11 +31,15 @@
 #include "shape_2d_sw.h"
 
 #include "core/math/geometry.h"
+#include "core/safe_refcount.h"
 #include "core/sort_array.h"
 
+uint64_t Shape2DSW::last_version = 0;
+
 void Shape2DSW::configure(const Rect2 &p_aabb) {
 	aabb = p_aabb;
 	configured = true;
+	version = atomic_increment(&last_version);
 	for (Map<ShapeOwner2DSW *, int>::Element *E = owners.front(); E; E = E->next()) {
 		ShapeOwner2DSW *co = (ShapeOwner2DSW *)E->key();
 		co->_shape_changed();
@@ -78,6 +82,7 @@ const Map<ShapeOwner2DSW *, int> &Shape2DSW::get_owners() const {
 Shape2DSW::Shape2DSW() {
 	custom_bias = 0;
 	configured = false;
+	version = atomic_increment(&last_version);
 }
 
 Shape2DSW::~Shape2DSW() {
@@ -61,6 +61,9 @@ class Shape2DSW {
 	Rect2 aabb;
 	bool configured;
 	real_t custom_bias;
+	uint64_t version;
+
+	static uint64_t last_version; // Shared by all shapes, so a recycled shape never repeats a version.
 
 	Map<ShapeOwner2DSW *, int> owners;
 
@@ -75,6 +78,7 @@ public:
 
 	_FORCE_INLINE_ Rect2 get_aabb() const { return aabb; }
 	_FORCE_INLINE_ bool is_configured() const { return configured; }
+	_FORCE_INLINE_ uint64_t get_version() const { return version; } // changes every time the shape data changes
 
 	virtual bool is_concave() const { return false; }
 
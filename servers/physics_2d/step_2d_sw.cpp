@@ -132,6 +132,7 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
+	p_space->reset_step_stats();
 
 	const SelfList<Body2DSW>::List *body_list = &p_space->get_active_body_list();
 
@@ -164,6 +165,7 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 	b = body_list->first();
 
 	int island_count = 0;
+	int largest_island = 0;
 
 	while (b) {
 		Body2DSW *body = b->self();
@@ -176,6 +178,12 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 			island->set_island_list_next(island_list);
 			island_list = island;
 
+			int island_size = 0;
+			for (Body2DSW *ib = island; ib; ib = ib->get_island_next()) {
+				island_size++;
+			}
+			largest_island = MAX(largest_island, island_size);
+
 			if (constraint_island) {
 				constraint_island->set_island_list_next(constraint_island_list);
 				constraint_island_list = constraint_island;
@@ -186,6 +194,7 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 	}
 
 	p_space->set_island_count(island_count);
+	p_space->set_largest_island(largest_island);
 
 	const SelfList<Area2DSW>::List &aml = p_space->get_moved_area_list();
 
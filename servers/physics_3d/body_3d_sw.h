@@ -225,6 +225,13 @@ public:
 		angular_velocity += _inv_inertia_tensor.xform((p_pos - center_of_mass).cross(p_j));
 	}
 
+	// Same as apply_impulse(), with the angular velocity change already computed by the caller
+	// (the contact solver caches it per contact, since it only depends on the contact direction).
+	_FORCE_INLINE_ void apply_impulse_precomputed(const Vector3 &p_j, const Vector3 &p_delta_av) {
+		linear_velocity += p_j * _inv_mass;
+		angular_velocity += p_delta_av;
+	}
+
 	_FORCE_INLINE_ void apply_torque_impulse(const Vector3 &p_j) {
 		angular_velocity += _inv_inertia_tensor.xform(p_j);
 	}
@@ -240,6 +247,17 @@ public:
 		}
 	}
 
+	_FORCE_INLINE_ void apply_bias_impulse_precomputed(const Vector3 &p_j, const Vector3 &p_delta_av, real_t p_max_delta_av = -1.0) {
+		biased_linear_velocity += p_j * _inv_mass;
+		if (p_max_delta_av != 0.0) {
+			if (p_max_delta_av > 0 && p_delta_av.length() > p_max_delta_av) {
+				biased_angular_velocity += p_delta_av.normalized() * p_max_delta_av;
+			} else {
+				biased_angular_velocity += p_delta_av;
+			}
+		}
+	}
+
 	_FORCE_INLINE_ void apply_bias_torque_impulse(const Vector3 &p_j) {
 		biased_angular_velocity += _inv_inertia_tensor.xform(p_j);
 	}
@@ -291,7 +309,7 @@ public:
 
 	_FORCE_INLINE_ real_t get_inv_mass() const { return _inv_mass; }
 	_FORCE_INLINE_ Vector3 get_inv_inertia() const { return _inv_inertia; }
-	_FORCE_INLINE_ Basis get_inv_inertia_tensor() const { return _inv_inertia_tensor; }
+	_FORCE_INLINE_ const Basis &get_inv_inertia_tensor() const { return _inv_inertia_tensor; }
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ Vector3 get_gravity() const { return gravity; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
@@ -238,6 +238,7 @@ bool BodyPair3DSW::setup(real_t p_step) {
 
 	bool collided = CollisionSolver3DSW::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
 	this->collided = collided;
+	space->add_pair_tested(collided);
 
 	if (!collided) {
 		//test ccd (currently just a raycast)
@@ -269,6 +270,9 @@ bool BodyPair3DSW::setup(real_t p_step) {
 
 	real_t inv_dt = 1.0 / p_step;
 
+	friction = combine_friction(A, B);
+	inv_mass_sum = A->get_inv_mass() + B->get_inv_mass();
+
 	for (int i = 0; i < contact_count; i++) {
 		Contact &c = contacts[i];
 		c.active = false;
@@ -311,10 +315,10 @@ bool BodyPair3DSW::setup(real_t p_step) {
 		c.active = true;
 
 		// Precompute normal mass, tangent mass, and bias.
-		Vector3 inertia_A = A->get_inv_inertia_tensor().xform(c.rA.cross(c.normal));
-		Vector3 inertia_B = B->get_inv_inertia_tensor().xform(c.rB.cross(c.normal));
-		real_t kNormal = A->get_inv_mass() + B->get_inv_mass();
-		kNormal += c.normal.dot(inertia_A.cross(c.rA)) + c.normal.dot(inertia_B.cross(c.rB));
+		c.ang_A = A->get_inv_inertia_tensor().xform(c.rA.cross(c.normal));
+		c.ang_B = B->get_inv_inertia_tensor().xform(c.rB.cross(c.normal));
+		real_t kNormal = inv_mass_sum;
+		kNormal += c.normal.dot(c.ang_A.cross(c.rA)) + c.normal.dot(c.ang_B.cross(c.rB));
 		c.mass_normal = 1.0f / kNormal;
 
 		c.bias = -bias * inv_dt * MIN(0.0f, -depth + max_penetration);
@@ -344,6 +348,8 @@ void BodyPair3DSW::solve(real_t p_step) {
 		return;
 	}
 
+	const real_t max_bias_av = MAX_BIAS_ROTATION / p_step;
+
 	for (int i = 0; i < contact_count; i++) {
 		Contact &c = contacts[i];
 		if (!c.active) {
@@ -365,10 +371,11 @@ void BodyPair3DSW::solve(real_t p_step) {
 			real_t jbnOld = c.acc_bias_impulse;
 			c.acc_bias_impulse = MAX(jbnOld + jbn, 0.0f);
 
-			Vector3 jb = c.normal * (c.acc_bias_impulse - jbnOld);
+			real_t djb = c.acc_bias_impulse - jbnOld;
+			Vector3 jb = c.normal * djb;
 
-			A->apply_bias_impulse(c.rA + A->get_center_of_mass(), -jb, MAX_BIAS_ROTATION / p_step);
-			B->apply_bias_impulse(c.rB + B->get_center_of_mass(), jb, MAX_BIAS_ROTATION / p_step);
+			A->apply_bias_impulse_precomputed(-jb, c.ang_A * -djb, max_bias_av);
+			B->apply_bias_impulse_precomputed(jb, c.ang_B * djb, max_bias_av);
 
 			crbA = A->get_biased_angular_velocity().cross(c.rA);
 			crbB = B->get_biased_angular_velocity().cross(c.rB);
@@ -377,7 +384,7 @@ void BodyPair3DSW::solve(real_t p_step) {
 			vbn = dbv.dot(c.normal);
 
 			if (Math::abs(-vbn + c.bias) > MIN_VELOCITY) {
-				real_t jbn_com = (-vbn + c.bias) / (A->get_inv_mass() + B->get_inv_mass());
+				real_t jbn_com = (-vbn + c.bias) / inv_mass_sum;
 				real_t jbnOld_com = c.acc_bias_impulse_center_of_mass;
 				c.acc_bias_impulse_center_of_mass = MAX(jbnOld_com + jbn_com, 0.0f);
 
@@ -402,18 +409,17 @@ void BodyPair3DSW::solve(real_t p_step) {
 			real_t jnOld = c.acc_normal_impulse;
 			c.acc_normal_impulse = MAX(jnOld + jn, 0.0f);
 
-			Vector3 j = c.normal * (c.acc_normal_impulse - jnOld);
+			real_t dj = c.acc_normal_impulse - jnOld;
+			Vector3 j = c.normal * dj;
 
-			A->apply_impulse(c.rA + A->get_center_of_mass(), -j);
-			B->apply_impulse(c.rB + B->get_center_of_mass(), j);
+			A->apply_impulse_precomputed(-j, c.ang_A * -dj);
+			B->apply_impulse_precomputed(j, c.ang_B * dj);
 
 			c.active = true;
 		}
 
 		//friction impulse
 
-		real_t friction = combine_friction(A, B);
-
 		Vector3 lvA = A->get_linear_velocity() + A->get_angular_velocity().cross(c.rA);
 		Vector3 lvB = B->get_linear_velocity() + B->get_angular_velocity().cross(c.rB);
 
@@ -431,7 +437,7 @@ void BodyPair3DSW::solve(real_t p_step) {
 			Vector3 temp2 = B->get_inv_inertia_tensor().xform(c.rB.cross(tv));
 
 			real_t t = -tvl /
-					   (A->get_inv_mass() + B->get_inv_mass() + tv.dot(temp1.cross(c.rA) + temp2.cross(c.rB)));
+					   (inv_mass_sum + tv.dot(temp1.cross(c.rA) + temp2.cross(c.rB)));
 
 			Vector3 jt = t * tv;
 
@@ -466,6 +472,8 @@ BodyPair3DSW::BodyPair3DSW(Body3DSW *p_A, int p_shape_A, Body3DSW *p_B, int p_sh
 	B->add_constraint(this, 1);
 	contact_count = 0;
 	collided = false;
+	friction = 0;
+	inv_mass_sum = 0;
 }
 
 BodyPair3DSW::~BodyPair3DSW() {
@@ -67,6 +67,7 @@ class BodyPair3DSW : public Constraint3DSW {
 		real_t depth;
 		bool active;
 		Vector3 rA, rB; // Offset in world orientation with respect to center of mass
+		Vector3 ang_A, ang_B; // Angular velocity change per unit impulse along the normal (inv_inertia * (r x n))
 	};
 
 	Vector3 offset_B; //use local A coordinates to avoid numerical issues on collision detection
@@ -76,6 +77,10 @@ class BodyPair3DSW : public Constraint3DSW {
 	int contact_count;
 	bool collided;
 
+	// Per pair constants, computed once in setup() instead of on every solver iteration.
+	real_t friction;
+	real_t inv_mass_sum;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, const Vector3 &p_point_B, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, const Vector3 &p_point_B);
@@ -33,6 +33,7 @@
 #include "broad_phase_3d_basic.h"
 #include "broad_phase_octree.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/os/os.h"
 #include "joints/cone_twist_joint_3d_sw.h"
 #include "joints/generic_6dof_joint_3d_sw.h"
@@ -1296,6 +1297,7 @@ void PhysicsServer3DSW::init() {
 
 void PhysicsServer3DSW::step(real_t p_step) {
 #ifndef _3D_DISABLED
+	TRACE_ZONE("PhysicsServer3D::step");
 
 	if (!active) {
 		return;
@@ -1311,11 +1313,19 @@ void PhysicsServer3DSW::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	largest_island = 0;
+	pairs_tested = 0;
+	pairs_colliding = 0;
+	query_count = 0;
 	for (Set<const Space3DSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
 		stepper->step((Space3DSW *)E->get(), p_step, iterations);
 		island_count += E->get()->get_island_count();
 		active_objects += E->get()->get_active_objects();
 		collision_pairs += E->get()->get_collision_pairs();
+		largest_island = MAX(largest_island, E->get()->get_largest_island());
+		pairs_tested += E->get()->get_pairs_tested();
+		pairs_colliding += E->get()->get_pairs_colliding();
+		query_count += E->get()->get_query_count();
 	}
 #endif
 }
@@ -1395,6 +1405,18 @@ int PhysicsServer3DSW::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_LARGEST_ISLAND: {
+			return largest_island;
+		} break;
+		case INFO_PAIRS_TESTED: {
+			return pairs_tested;
+		} break;
+		case INFO_PAIRS_COLLIDING: {
+			return pairs_colliding;
+		} break;
+		case INFO_QUERY_COUNT: {
+			return query_count;
+		} break;
 	}
 
 	return 0;
@@ -1446,6 +1468,10 @@ PhysicsServer3DSW::PhysicsServer3DSW() {
 	BroadPhase3DSW::create_func = BroadPhaseOctree::_create;
 	island_count = 0;
 	active_objects = 0;
+	largest_island = 0;
+	pairs_tested = 0;
+	pairs_colliding = 0;
+	query_count = 0;
 	collision_pairs = 0;
 
 	active = true;
@@ -50,6 +50,10 @@ class PhysicsServer3DSW : public PhysicsServer3D {
 	int island_count;
 	int active_objects;
 	int collision_pairs;
+	int largest_island;
+	int pairs_tested;
+	int pairs_colliding;
+	int query_count;
 
 	bool flushing_queries;
 
@@ -1074,54 +1074,6 @@ Vector3 ConcavePolygonShape3DSW::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void ConcavePolygonShape3DSW::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *bvh = &p_params->bvh[p_idx];
-
-	/*
-	if (p_params->dir.dot(bvh->aabb.get_support(-p_params->dir))>p_params->min_d)
-		return; //test against whole AABB, which isn't very costly
-	*/
-
-	//printf("addr: %p\n",bvh);
-	if (!bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
-	}
-
-	if (bvh->face_index >= 0) {
-		Vector3 res;
-		Vector3 vertices[3] = {
-			p_params->vertices[p_params->faces[bvh->face_index].indices[0]],
-			p_params->vertices[p_params->faces[bvh->face_index].indices[1]],
-			p_params->vertices[p_params->faces[bvh->face_index].indices[2]]
-		};
-
-		if (Geometry::segment_intersects_triangle(
-					p_params->from,
-					p_params->to,
-					vertices[0],
-					vertices[1],
-					vertices[2],
-					&res)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			//TODO, seems segmen/triangle intersection is broken :(
-			if (d > 0 && d < p_params->min_d) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = Plane(vertices[0], vertices[1], vertices[2]).normal;
-				p_params->collisions++;
-			}
-		}
-
-	} else {
-		if (bvh->left >= 0) {
-			_cull_segment(bvh->left, p_params);
-		}
-		if (bvh->right >= 0) {
-			_cull_segment(bvh->right, p_params);
-		}
-	}
-}
-
 bool ConcavePolygonShape3DSW::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal) const {
 	if (faces.size() == 0) {
 		return false;
@@ -1132,27 +1084,47 @@ bool ConcavePolygonShape3DSW::intersect_segment(const Vector3 &p_begin, const Ve
 	const Vector3 *vr = vertices.ptr();
 	const BVH *br = bvh.ptr();
 
-	_SegmentCullParams params;
-	params.from = p_begin;
-	params.to = p_end;
-	params.collisions = 0;
-	params.dir = (p_end - p_begin).normalized();
+	Vector3 dir = (p_end - p_begin).normalized();
+	real_t min_d = 1e20;
+	bool collided = false;
 
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
+	int *stack = (int *)alloca(sizeof(int) * bvh_depth);
+	int stack_size = 0;
+	int node = 0;
 
-	params.min_d = 1e20;
-	// cull
-	_cull_segment(0, &params);
+	while (true) {
+		const BVH &b = br[node];
 
-	if (params.collisions > 0) {
-		r_result = params.result;
-		r_normal = params.normal;
-		return true;
-	} else {
-		return false;
+		if (b.aabb.intersects_segment(p_begin, p_end)) {
+			if (b.face_index < 0) {
+				// branch, visit left now and right later
+				stack[stack_size++] = b.right;
+				node++;
+				continue;
+			}
+
+			const Face &f = fr[b.face_index];
+			Vector3 res;
+
+			if (Geometry::segment_intersects_triangle(p_begin, p_end, vr[f.indices[0]], vr[f.indices[1]], vr[f.indices[2]], &res)) {
+				real_t d = dir.dot(res) - dir.dot(p_begin);
+				//TODO, seems segmen/triangle intersection is broken :(
+				if (d > 0 && d < min_d) {
+					min_d = d;
+					r_result = res;
+					r_normal = Plane(vr[f.indices[0]], vr[f.indices[1]], vr[f.indices[2]]).normal;
+					collided = true;
+				}
+			}
+		}
+
+		if (stack_size == 0) {
+			break;
+		}
+		node = stack[--stack_size];
 	}
+
+	return collided;
 }
 
 bool ConcavePolygonShape3DSW::intersect_point(const Vector3 &p_point) const {
@@ -1163,41 +1135,12 @@ Vector3 ConcavePolygonShape3DSW::get_closest_point_to(const Vector3 &p_point) co
 	return Vector3();
 }
 
-void ConcavePolygonShape3DSW::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *bvh = &p_params->bvh[p_idx];
-
-	if (!p_params->aabb.intersects(bvh->aabb)) {
-		return;
-	}
-
-	if (bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[bvh->face_index];
-		FaceShape3DSW *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		p_params->callback(p_params->userdata, face);
-
-	} else {
-		if (bvh->left >= 0) {
-			_cull(bvh->left, p_params);
-		}
-
-		if (bvh->right >= 0) {
-			_cull(bvh->right, p_params);
-		}
-	}
-}
-
 void ConcavePolygonShape3DSW::cull(const AABB &p_local_aabb, Callback p_callback, void *p_userdata) const {
 	// make matrix local to concave
 	if (faces.size() == 0) {
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
-
 	// unlock data
 	const Face *fr = faces.ptr();
 	const Vector3 *vr = vertices.ptr();
@@ -1205,17 +1148,34 @@ void ConcavePolygonShape3DSW::cull(const AABB &p_local_aabb, Callback p_callback
 
 	FaceShape3DSW face; // use this to send in the callback
 
-	_CullParams params;
-	params.aabb = local_aabb;
-	params.face = &face;
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
-	params.callback = p_callback;
-	params.userdata = p_userdata;
+	int *stack = (int *)alloca(sizeof(int) * bvh_depth);
+	int stack_size = 0;
+	int node = 0;
+
+	while (true) {
+		const BVH &b = br[node];
+
+		if (p_local_aabb.intersects(b.aabb)) {
+			if (b.face_index < 0) {
+				// branch, visit left now and right later
+				stack[stack_size++] = b.right;
+				node++;
+				continue;
+			}
+
+			const Face &f = fr[b.face_index];
+			face.normal = f.normal;
+			face.vertex[0] = vr[f.indices[0]];
+			face.vertex[1] = vr[f.indices[1]];
+			face.vertex[2] = vr[f.indices[2]];
+			p_callback(p_userdata, &face);
+		}
 
-	// cull
-	_cull(0, &params);
+		if (stack_size == 0) {
+			break;
+		}
+		node = stack[--stack_size];
+	}
 }
 
 Vector3 ConcavePolygonShape3DSW::get_moment_of_inertia(real_t p_mass) const {
@@ -1252,87 +1212,50 @@ struct _VolumeSW_BVH_CompareZ {
 	}
 };
 
-struct _VolumeSW_BVH {
-	AABB aabb;
-	_VolumeSW_BVH *left;
-	_VolumeSW_BVH *right;
+// Builds the subtree for p_elements directly into p_bvh_array at p_index (depth first), returns the amount of nodes written.
+static int _volume_sw_build_bvh(_VolumeSW_BVH_Element *p_elements, int p_size, ConcavePolygonShape3DSW::BVH *p_bvh_array, int p_index, int p_depth, int &r_max_depth) {
+	r_max_depth = MAX(r_max_depth, p_depth);
 
-	int face_index;
-};
-
-_VolumeSW_BVH *_volume_sw_build_bvh(_VolumeSW_BVH_Element *p_elements, int p_size, int &count) {
-	_VolumeSW_BVH *bvh = memnew(_VolumeSW_BVH);
+	ConcavePolygonShape3DSW::BVH *bvh = &p_bvh_array[p_index];
 
 	if (p_size == 1) {
 		//leaf
 		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
+		bvh->right = -1;
+		bvh->face_index = p_elements[0].face_index;
+		return 1;
 	}
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
-		}
+	AABB aabb = p_elements[0].aabb;
+	for (int i = 1; i < p_size; i++) {
+		aabb.merge_with(p_elements[i].aabb);
 	}
 	bvh->aabb = aabb;
+	bvh->face_index = -1;
+
+	// Only the median needs to be in place, so partition instead of sorting the whole range.
+	int split = p_size / 2;
+
 	switch (aabb.get_longest_axis_index()) {
 		case 0: {
 			SortArray<_VolumeSW_BVH_Element, _VolumeSW_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
-
+			sort_x.nth_element(0, p_size, split, p_elements);
 		} break;
 		case 1: {
 			SortArray<_VolumeSW_BVH_Element, _VolumeSW_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
+			sort_y.nth_element(0, p_size, split, p_elements);
 		} break;
 		case 2: {
 			SortArray<_VolumeSW_BVH_Element, _VolumeSW_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
+			sort_z.nth_element(0, p_size, split, p_elements);
 		} break;
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_sw_build_bvh(p_elements, split, count);
-	bvh->right = _volume_sw_build_bvh(&p_elements[split], p_size - split, count);
+	int left_count = _volume_sw_build_bvh(p_elements, split, p_bvh_array, p_index + 1, p_depth + 1, r_max_depth);
+	bvh->right = p_index + 1 + left_count;
+	int right_count = _volume_sw_build_bvh(&p_elements[split], p_size - split, p_bvh_array, bvh->right, p_depth + 1, r_max_depth);
 
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
-}
-
-void ConcavePolygonShape3DSW::_fill_bvh(_VolumeSW_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
-
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
-
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
-	}
-
-	memdelete(p_bvh_tree);
+	return 1 + left_count + right_count;
 }
 
 void ConcavePolygonShape3DSW::_setup(Vector<Vector3> p_faces) {
@@ -1380,15 +1303,11 @@ void ConcavePolygonShape3DSW::_setup(Vector<Vector3> p_faces) {
 		}
 	}
 
-	int count = 0;
-	_VolumeSW_BVH *bvh_tree = _volume_sw_build_bvh(bvh_arrayw, src_face_count, count);
-
-	bvh.resize(count + 1);
-
-	BVH *bvh_arrayw2 = bvh.ptrw();
+	// A binary tree with one face per leaf always has 2n - 1 nodes.
+	bvh.resize(src_face_count * 2 - 1);
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	bvh_depth = 0;
+	_volume_sw_build_bvh(bvh_arrayw, src_face_count, bvh.ptrw(), 0, 1, bvh_depth);
 
 	configure(_aabb); // this type of shape has no margin
 }
@@ -1402,6 +1321,7 @@ Variant ConcavePolygonShape3DSW::get_data() const {
 }
 
 ConcavePolygonShape3DSW::ConcavePolygonShape3DSW() {
+	bvh_depth = 0;
 }
 
 /* HEIGHT MAP SHAPE */
@@ -276,7 +276,6 @@ public:
 	ConvexPolygonShape3DSW();
 };
 
-struct _VolumeSW_BVH;
 struct FaceShape3DSW;
 
 struct ConcavePolygonShape3DSW : public ConcaveShape3DSW {
@@ -290,44 +289,17 @@ struct ConcavePolygonShape3DSW : public ConcaveShape3DSW {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Nodes are stored depth first, so the left child of a branch is always the next node.
+	// Branches always have two children, leaves have a face index and no children.
 	struct BVH {
 		AABB aabb;
-		int left;
 		int right;
 
 		int face_index;
 	};
 
 	Vector<BVH> bvh;
-
-	struct _CullParams {
-		AABB aabb;
-		Callback callback;
-		void *userdata;
-		const Face *faces;
-		const Vector3 *vertices;
-		const BVH *bvh;
-		FaceShape3DSW *face;
-	};
-
-	struct _SegmentCullParams {
-		Vector3 from;
-		Vector3 to;
-		const Face *faces;
-		const Vector3 *vertices;
-		const BVH *bvh;
-		Vector3 dir;
-
-		Vector3 result;
-		Vector3 normal;
-		real_t min_d;
-		int collisions;
-	};
-
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	void _cull(int p_idx, _CullParams *p_params) const;
-
-	void _fill_bvh(_VolumeSW_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	int bvh_depth;
 
 	void _setup(Vector<Vector3> p_faces);
 
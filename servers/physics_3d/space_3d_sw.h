@@ -39,6 +39,7 @@
 #include "collision_object_3d_sw.h"
 #include "core/hash_map.h"
 #include "core/project_settings.h"
+#include "core/safe_refcount.h"
 #include "core/typedefs.h"
 
 class PhysicsDirectSpaceState3DSW : public PhysicsDirectSpaceState3D {
@@ -114,6 +115,11 @@ private:
 	int island_count;
 	int active_objects;
 	int collision_pairs;
+	int largest_island;
+	int pairs_tested;
+	int pairs_colliding;
+	uint32_t query_count; // Queries may come from several threads.
+	uint32_t last_step_query_count;
 
 	RID static_global_body;
 
@@ -180,6 +186,30 @@ public:
 
 	int get_collision_pairs() const { return collision_pairs; }
 
+	void set_largest_island(int p_body_count) { largest_island = p_body_count; }
+	int get_largest_island() const { return largest_island; }
+
+	_FORCE_INLINE_ void add_pair_tested(bool p_colliding) {
+		pairs_tested++;
+		if (p_colliding) {
+			pairs_colliding++;
+		}
+	}
+	int get_pairs_tested() const { return pairs_tested; }
+	int get_pairs_colliding() const { return pairs_colliding; }
+
+	_FORCE_INLINE_ void add_query() { atomic_increment(&query_count); }
+	int get_query_count() const { return last_step_query_count; } // queries made between the last two steps
+
+	void reset_step_stats() {
+		largest_island = 0;
+		pairs_tested = 0;
+		pairs_colliding = 0;
+		uint32_t count = query_count;
+		atomic_sub(&query_count, count); // Keeps queries made meanwhile for the next step.
+		last_step_query_count = count;
+	}
+
 	PhysicsDirectSpaceState3DSW *get_direct_state();
 
 	void set_debug_contacts(int p_amount) { contact_debug.resize(p_amount); }
@@ -143,6 +143,7 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
+	p_space->reset_step_stats();
 
 	const SelfList<Body3DSW>::List *body_list = &p_space->get_active_body_list();
 
@@ -175,6 +176,7 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 	b = body_list->first();
 
 	int island_count = 0;
+	int largest_island = 0;
 
 	while (b) {
 		Body3DSW *body = b->self();
@@ -187,6 +189,12 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 			island->set_island_list_next(island_list);
 			island_list = island;
 
+			int island_size = 0;
+			for (Body3DSW *ib = island; ib; ib = ib->get_island_next()) {
+				island_size++;
+			}
+			largest_island = MAX(largest_island, island_size);
+
 			if (constraint_island) {
 				constraint_island->set_island_list_next(constraint_island_list);
 				constraint_island_list = constraint_island;
@@ -197,6 +205,7 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 	}
 
 	p_space->set_island_count(island_count);
+	p_space->set_largest_island(largest_island);
 
 	const SelfList<Area3DSW>::List &aml = p_space->get_moved_area_list();
 
@@ -688,6 +688,10 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_LARGEST_ISLAND);
+	BIND_ENUM_CONSTANT(INFO_PAIRS_TESTED);
+	BIND_ENUM_CONSTANT(INFO_PAIRS_COLLIDING);
+	BIND_ENUM_CONSTANT(INFO_QUERY_COUNT);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
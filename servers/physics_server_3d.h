@@ -757,7 +757,11 @@ public:
 
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_LARGEST_ISLAND,
+		INFO_PAIRS_TESTED,
+		INFO_PAIRS_COLLIDING,
+		INFO_QUERY_COUNT
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
@@ -3222,6 +3222,19 @@ void RasterizerStorageRD::skeleton_bone_set_transform_2d(RID p_skeleton, int p_b
 	_skeleton_make_dirty(skeleton);
 }
 
+void RasterizerStorageRD::skeleton_set_bone_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.getornull(p_skeleton);
+
+	ERR_FAIL_COND(!skeleton);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->data.size());
+
+	if (p_buffer.size()) {
+		copymem(skeleton->data.ptrw(), p_buffer.ptr(), p_buffer.size() * sizeof(float));
+	}
+
+	_skeleton_make_dirty(skeleton);
+}
+
 Transform2D RasterizerStorageRD::skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.getornull(p_skeleton);
 
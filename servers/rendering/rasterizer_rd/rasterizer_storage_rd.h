@@ -1004,6 +1004,7 @@ public:
 	void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform &p_transform);
 	Transform skeleton_bone_get_transform(RID p_skeleton, int p_bone) const;
 	void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform);
+	void skeleton_set_bone_buffer(RID p_skeleton, const Vector<float> &p_buffer);
 	Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const;
 
 	_FORCE_INLINE_ RID skeleton_get_3d_uniform_set(RID p_skeleton, RID p_shader, uint32_t p_set) const {
@@ -30,6 +30,7 @@
 
 #include "rendering_server_raster.h"
 
+#include "core/debugger/trace_recorder.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "core/project_settings.h"
@@ -95,6 +96,8 @@ void RenderingServerRaster::request_frame_drawn_callback(Object *p_where, const
 }
 
 void RenderingServerRaster::draw(bool p_swap_buffers, double frame_step) {
+	TRACE_ZONE("RenderingServer::draw");
+
 	//needs to be done before changes is reset to 0, to not force the editor to redraw
 	RS::get_singleton()->emit_signal("frame_pre_draw");
 
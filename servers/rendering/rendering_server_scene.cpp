@@ -621,6 +621,20 @@ void RenderingServerScene::instance_set_transform(RID p_instance, const Transfor
 	_instance_queue_update(instance, true);
 }
 
+void RenderingServerScene::instances_set_transforms(const Vector<RID> &p_instances, const Vector<Transform> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform *transforms = p_transforms.ptr();
+
+	for (int i = 0; i < p_instances.size(); i++) {
+		if (!instance_owner.owns(instances[i])) {
+			continue; // freed since it was queued
+		}
+		instance_set_transform(instances[i], transforms[i]);
+	}
+}
+
 void RenderingServerScene::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.getornull(p_instance);
 	ERR_FAIL_COND(!instance);
@@ -63,8 +63,8 @@ void RenderingServerWrapMT::thread_loop() {
 	exit = false;
 	draw_thread_up = true;
 	while (!exit) {
-		// flush commands one by one, until exit is requested
-		command_queue.wait_and_flush_one();
+		// flush commands as they are published, until exit is requested
+		command_queue.wait_and_flush();
 	}
 
 	command_queue.flush_all(); // flush all
@@ -83,6 +83,18 @@ void RenderingServerWrapMT::sync() {
 	}
 }
 
+void RenderingServerWrapMT::begin_command_batch() {
+	if (create_thread) {
+		command_queue.begin_batch();
+	}
+}
+
+void RenderingServerWrapMT::end_command_batch() {
+	if (create_thread) {
+		command_queue.end_batch();
+	}
+}
+
 void RenderingServerWrapMT::draw(bool p_swap_buffers, double frame_step) {
 	if (create_thread) {
 		atomic_increment(&draw_pending);
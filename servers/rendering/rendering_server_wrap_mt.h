@@ -32,6 +32,7 @@
 #define RENDERING_SERVER_WRAP_MT_H
 
 #include "core/command_queue_mt.h"
+#include "core/hash_map.h"
 #include "core/os/thread.h"
 #include "servers/rendering_server.h"
 
@@ -58,6 +59,11 @@ class RenderingServerWrapMT : public RenderingServer {
 
 	Mutex alloc_mutex;
 
+	// Values mirrored from setters, so the matching getters don't need a
+	// round-trip to the server thread.
+	Mutex cache_mutex;
+	HashMap<RID, bool> particles_emitting_cache;
+
 	int pool_max_size;
 
 	//#define DEBUG_SYNC
@@ -220,6 +226,7 @@ public:
 	FUNC3(skeleton_bone_set_transform, RID, int, const Transform &)
 	FUNC2RC(Transform, skeleton_bone_get_transform, RID, int)
 	FUNC3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
+	FUNC2(skeleton_set_bone_buffer, RID, const Vector<float> &)
 	FUNC2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
 	FUNC2(skeleton_set_base_transform_2d, RID, const Transform2D &)
 
@@ -339,8 +346,8 @@ public:
 
 	FUNCRID(particles)
 
-	FUNC2(particles_set_emitting, RID, bool)
-	FUNC1R(bool, particles_get_emitting, RID)
+	FUNC2CACHE(particles_set_emitting, particles_emitting_cache, RID, bool)
+	FUNC1RCACHE(bool, particles_get_emitting, particles_emitting_cache, RID)
 	FUNC2(particles_set_amount, RID, int)
 	FUNC2(particles_set_lifetime, RID, float)
 	FUNC2(particles_set_one_shot, RID, bool)
@@ -507,6 +514,7 @@ public:
 	FUNC2(instance_set_scenario, RID, RID)
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC2(instance_set_transform, RID, const Transform &)
+	FUNC2(instances_set_transforms, const Vector<RID> &, const Vector<Transform> &)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_material, RID, int, RID)
@@ -653,7 +661,17 @@ public:
 
 	/* FREE */
 
-	FUNC1(free, RID)
+	virtual void free(RID p_rid) {
+		{
+			MutexLock lock(cache_mutex);
+			particles_emitting_cache.erase(p_rid);
+		}
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(rendering_server, &RenderingServer::free, p_rid);
+		} else {
+			rendering_server->free(p_rid);
+		}
+	}
 
 	/* EVENT QUEUING */
 
@@ -663,6 +681,8 @@ public:
 	virtual void finish();
 	virtual void draw(bool p_swap_buffers, double frame_step);
 	virtual void sync();
+	virtual void begin_command_batch();
+	virtual void end_command_batch();
 	FUNC0RC(bool, has_changed)
 
 	/* RENDER INFO */
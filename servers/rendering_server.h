@@ -360,6 +360,8 @@ public:
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform &p_transform) = 0;
 	virtual Transform skeleton_bone_get_transform(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
+	// Sets all bones at once, as 12 floats per bone (8 in 2D) laid out as rows: basis row, then origin component.
+	virtual void skeleton_set_bone_buffer(RID p_skeleton, const Vector<float> &p_buffer) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) = 0;
 
@@ -902,6 +904,8 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario) = 0;
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform &p_transform) = 0;
+	// Same as calling instance_set_transform() for each pair, as a single call. Instances freed meanwhile are skipped.
+	virtual void instances_set_transforms(const Vector<RID> &p_instances, const Vector<Transform> &p_transforms) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -1170,6 +1174,11 @@ public:
 	virtual void init() = 0;
 	virtual void finish() = 0;
 
+	// When the server runs on its own thread, commands issued by the calling
+	// thread between these are handed over to it at once.
+	virtual void begin_command_batch() {}
+	virtual void end_command_batch() {}
+
 	/* STATUS INFORMATION */
 
 	enum RenderInfo {
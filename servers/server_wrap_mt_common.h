@@ -298,6 +298,25 @@
 		}                                                                           \
 	}
 
+#define FUNC1RCACHE(m_r, m_type, m_cache, m_arg1)                                  \
+	virtual m_r m_type(m_arg1 p1) {                                                 \
+		if (Thread::get_caller_id() != server_thread) {                             \
+			{                                                                       \
+				MutexLock lock(cache_mutex);                                        \
+				const m_r *cached = m_cache.getptr(p1);                             \
+				if (cached) {                                                       \
+					return *cached;                                                 \
+				}                                                                   \
+			}                                                                       \
+			m_r ret;                                                                \
+			command_queue.push_and_ret(server_name, &ServerName::m_type, p1, &ret); \
+			SYNC_DEBUG                                                              \
+			return ret;                                                             \
+		} else {                                                                    \
+			return server_name->m_type(p1);                                         \
+		}                                                                           \
+	}
+
 #define FUNC1S(m_type, m_arg1)                                                 \
 	virtual void m_type(m_arg1 p1) {                                           \
 		if (Thread::get_caller_id() != server_thread) {                        \
@@ -389,6 +408,19 @@
 		}                                                                 \
 	}
 
+#define FUNC2CACHE(m_type, m_cache, m_arg1, m_arg2)                          \
+	virtual void m_type(m_arg1 p1, m_arg2 p2) {                               \
+		{                                                                     \
+			MutexLock lock(cache_mutex);                                      \
+			m_cache[p1] = p2;                                                 \
+		}                                                                     \
+		if (Thread::get_caller_id() != server_thread) {                       \
+			command_queue.push(server_name, &ServerName::m_type, p1, p2);     \
+		} else {                                                              \
+			server_name->m_type(p1, p2);                                      \
+		}                                                                     \
+	}
+
 #define FUNC2C(m_type, m_arg1, m_arg2)                                    \
 	virtual void m_type(m_arg1 p1, m_arg2 p2) const {                     \
 		if (Thread::get_caller_id() != server_thread) {                   \